@@ -71,7 +71,7 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        sutPort->m_chunkSenderData.m_queueSnapshots[0].emplace_back(&serverChunkQueueData);
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
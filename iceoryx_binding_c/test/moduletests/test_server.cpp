@@ -86,7 +86,7 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        sutPort->m_chunkSenderData.m_queueSnapshots[0].emplace_back(&clientResponseQueueData);
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -93,6 +93,18 @@ class MpmcLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices pointer to an array with at least maxNumberOfIndices elements
+    /// @param [in] maxNumberOfIndices the maximum number of indices to pop
+    /// @return the number of popped indices which were written to the front of indices
+    uint32_t pop(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously poped elements with a single compare-and-swap on the head
+    /// @param [in] indices pointer to an array with numberOfIndices previously poped elements
+    /// @param [in] numberOfIndices the number of indices to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in the latter case nothing is pushed
+    bool push(const Index_t* const indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -111,5 +111,102 @@ bool MpmcLoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t MpmcLoFFLi::pop(Index_t* const indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    if (indices == nullptr || maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        /// the walk along the list might observe indices which are concurrently modified by other threads; this is
+        /// detected by the compare-and-swap since every successful pop or push increments the aba counter
+        numberOfIndices = 0U;
+        Index_t nextIndex = oldHead.indexToNextFreeIndex;
+        while (nextIndex < m_size && numberOfIndices < maxNumberOfIndices)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by maxNumberOfIndices
+            indices[numberOfIndices] = nextIndex;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextIndex = m_nextFreeIndex.get()[nextIndex];
+        }
+
+        // we are empty if next points to an element with index of Size
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) see single element 'pop'
+        m_nextFreeIndex.get()[indices[i]] = m_invalidIndex;
+    }
+
+    /// see single element 'pop' for the reasoning of the fence
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool MpmcLoFFLi::push(const Index_t* const indices, const uint32_t numberOfIndices) noexcept
+{
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (indices == nullptr || !m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// the indices are linked to a chain before the chain is prepended to the free-list; a linked index is no longer
+    /// marked as acquired which also detects an index which is contained multiple times in 'indices'
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices and capacity
+        const auto index = indices[i];
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                m_nextFreeIndex.get()[indices[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+        m_nextFreeIndex.get()[index] = (i + 1U < numberOfIndices) ? indices[i + 1U] : m_size;
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) limited by numberOfIndices
+    const auto lastIndex = indices[numberOfIndices - 1U];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
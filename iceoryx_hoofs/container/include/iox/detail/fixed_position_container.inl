@@ -550,6 +550,33 @@ FixedPositionContainer<T, CAPACITY>::iter_from_index(const IndexType index) cons
     return ConstIterator(index, *this);
 }
 
+template <typename T, uint64_t CAPACITY>
+inline typename FixedPositionContainer<T, CAPACITY>::Iterator
+FixedPositionContainer<T, CAPACITY>::iter_from_ptr(const T* ptr)
+{
+    const auto it = static_cast<const FixedPositionContainer*>(this)->iter_from_ptr(ptr);
+    return Iterator(it.to_index(), *this);
+}
+
+template <typename T, uint64_t CAPACITY>
+inline typename FixedPositionContainer<T, CAPACITY>::ConstIterator
+FixedPositionContainer<T, CAPACITY>::iter_from_ptr(const T* ptr) const
+{
+    const T* const firstElement = &m_data[0];
+    const T* const lastElement = &m_data[Index::LAST];
+    if (ptr < firstElement || ptr > lastElement)
+    {
+        return end();
+    }
+
+    const auto index = static_cast<IndexType>(ptr - firstElement);
+    if (ptr != &m_data[index])
+    {
+        return end();
+    }
+    return iter_from_index(index);
+}
+
 template <typename T, uint64_t CAPACITY>
 inline typename FixedPositionContainer<T, CAPACITY>::Iterator FixedPositionContainer<T, CAPACITY>::begin() noexcept
 {
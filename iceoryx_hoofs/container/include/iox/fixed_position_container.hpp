@@ -153,6 +153,18 @@ class FixedPositionContainer final
     /// an empty slot
     [[nodiscard]] ConstIterator iter_from_index(const IndexType index) const;
 
+    /// @brief Get the iterator to the element pointed to by the pointer
+    /// @param[in] ptr to the element for the iterator
+    /// @return iterator pointing to the element or end iterator if the pointer does not point to an element of the
+    /// container or points to an empty slot
+    [[nodiscard]] Iterator iter_from_ptr(const T* ptr);
+
+    /// @brief Get the const iterator to the element pointed to by the pointer
+    /// @param[in] ptr to the element for the iterator
+    /// @return iterator pointing to the element or end iterator if the pointer does not point to an element of the
+    /// container or points to an empty slot
+    [[nodiscard]] ConstIterator iter_from_ptr(const T* ptr) const;
+
     /// @brief Get an iterator pointing to the beginning of the container
     /// @return iterator pointing to the beginning of the container
     [[nodiscard]] Iterator begin() noexcept;
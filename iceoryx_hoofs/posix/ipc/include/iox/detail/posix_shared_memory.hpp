@@ -22,6 +22,8 @@
 #include "iox/expected.hpp"
 #include "iox/file_management_interface.hpp"
 #include "iox/filesystem.hpp"
+#include "iox/optional.hpp"
+#include "iox/path.hpp"
 #include "iox/string.hpp"
 
 #include <cstdint>
@@ -87,10 +89,22 @@ class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
     ///         SharedMemoryError when the underlying shm_unlink call failed.
     static expected<bool, PosixSharedMemoryError> unlinkIfExist(const Name_t& name) noexcept;
 
+    /// @brief removes shared memory with a given name from the system
+    /// @param[in] name name of the shared memory
+    /// @param[in] mountPoint the file system in which the shared memory was created, see
+    ///            PosixSharedMemoryBuilder::mountPoint; the default shared memory file system is used on nullopt
+    /// @return true if the shared memory was removed, false if the shared memory did not exist and
+    ///         SharedMemoryError when the underlying unlink call failed.
+    static expected<bool, PosixSharedMemoryError> unlinkIfExist(const Name_t& name,
+                                                                const optional<Path>& mountPoint) noexcept;
+
     friend class PosixSharedMemoryBuilder;
 
   private:
-    PosixSharedMemory(const Name_t& name, const shm_handle_t handle, const bool hasOwnership) noexcept;
+    PosixSharedMemory(const Name_t& name,
+                      const optional<Path>& mountPoint,
+                      const shm_handle_t handle,
+                      const bool hasOwnership) noexcept;
 
     bool unlink() noexcept;
     bool close() noexcept;
@@ -103,6 +117,7 @@ class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
     shm_handle_t get_file_handle() const noexcept;
 
     Name_t m_name;
+    optional<Path> m_mountPoint;
     shm_handle_t m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
 };
@@ -127,6 +142,12 @@ class PosixSharedMemoryBuilder
     /// @brief Defines the size of the shared memory
     IOX_BUILDER_PARAMETER(uint64_t, size, 0U)
 
+    /// @brief If set, the shared memory is created as a file in the file system mounted at the provided
+    ///        path instead of the default shared memory file system, e.g. in a hugetlbfs to back the
+    ///        shared memory with huge pages. The size of the shared memory must then be a multiple of
+    ///        the page size of the file system.
+    IOX_BUILDER_PARAMETER(optional<Path>, mountPoint, nullopt)
+
   public:
     /// @brief creates a valid SharedMemory object. If the construction failed the expected
     ///        contains an enum value describing the error.
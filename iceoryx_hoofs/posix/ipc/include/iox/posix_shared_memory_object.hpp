@@ -117,6 +117,10 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief If set, the shared memory is created in the file system mounted at the provided path, e.g. a
+    ///        hugetlbfs to back the shared memory with huge pages; see PosixSharedMemoryBuilder::mountPoint
+    IOX_BUILDER_PARAMETER(optional<Path>, mountPoint, nullopt)
+
   public:
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
@@ -39,6 +39,61 @@ string<PosixSharedMemory::Name_t::capacity() + 1> addLeadingSlash(const PosixSha
     return nameWithLeadingSlash;
 }
 
+using ShmFilePath_t = string<platform::IOX_MAX_PATH_LENGTH>;
+
+/// @brief the path of a shared memory which is created in a dedicated mount point
+optional<ShmFilePath_t> shmFilePath(const Path& mountPoint, const PosixSharedMemory::Name_t& name) noexcept
+{
+    ShmFilePath_t filePath;
+    if (!filePath.unsafe_append(mountPoint.as_string()) || !filePath.unsafe_append('/')
+        || !filePath.unsafe_append(name))
+    {
+        return nullopt;
+    }
+    return filePath;
+}
+
+/// @brief opens the shared memory either with shm_open or, when a mount point is provided, as a file in the mount
+/// point
+expected<PosixCallResult<int>, PosixCallResult<int>> openShm(const PosixSharedMemory::Name_t& name,
+                                                             const optional<ShmFilePath_t>& filePath,
+                                                             const int oflags,
+                                                             const mode_t mode,
+                                                             const int suppressedErrno) noexcept
+{
+    if (filePath)
+    {
+        return IOX_POSIX_CALL(iox_open)(filePath->c_str(), oflags, mode)
+            .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
+            .suppressErrorMessagesForErrnos(suppressedErrno)
+            .evaluate();
+    }
+
+    return IOX_POSIX_CALL(iox_shm_open)(addLeadingSlash(name).c_str(), oflags, mode)
+        .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
+        .suppressErrorMessagesForErrnos(suppressedErrno)
+        .evaluate();
+}
+
+/// @brief unlinks the shared memory either with shm_unlink or, when a mount point is provided, as a file in the
+/// mount point
+expected<PosixCallResult<int>, PosixCallResult<int>> unlinkShm(const PosixSharedMemory::Name_t& name,
+                                                               const optional<ShmFilePath_t>& filePath) noexcept
+{
+    if (filePath)
+    {
+        return IOX_POSIX_CALL(iox_unlink)(filePath->c_str())
+            .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
+            .ignoreErrnos(ENOENT)
+            .evaluate();
+    }
+
+    return IOX_POSIX_CALL(iox_shm_unlink)(addLeadingSlash(name).c_str())
+        .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
+        .ignoreErrnos(ENOENT)
+        .evaluate();
+}
+
 // NOLINTJUSTIFICATION the function size and cognitive complexity results from the error handling and the expanded log macro
 // NOLINTNEXTLINE(readability-function-size,readability-function-cognitive-complexity)
 expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::create() noexcept
@@ -67,7 +122,18 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
         return err(PosixSharedMemoryError::INVALID_FILE_NAME);
     }
 
-    auto nameWithLeadingSlash = addLeadingSlash(m_name);
+    optional<ShmFilePath_t> filePath;
+    if (m_mountPoint)
+    {
+        filePath = shmFilePath(*m_mountPoint, m_name);
+        if (!filePath)
+        {
+            IOX_LOG(Error,
+                    "The shared memory \"" << m_name << "\" in the mount point \"" << m_mountPoint->as_string()
+                                           << "\" exceeds the maximum path length");
+            return err(PosixSharedMemoryError::INVALID_FILE_NAME);
+        }
+    }
 
     bool hasOwnership = (m_openMode == OpenMode::ExclusiveCreate || m_openMode == OpenMode::PurgeAndCreate
                          || m_openMode == OpenMode::OpenOrCreate);
@@ -88,21 +154,16 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
 
         if (m_openMode == OpenMode::PurgeAndCreate)
         {
-            IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_shm_unlink)(nameWithLeadingSlash.c_str())
-                                   .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
-                                   .ignoreErrnos(ENOENT)
-                                   .evaluate());
+            IOX_DISCARD_RESULT(unlinkShm(m_name, filePath));
         }
 
         auto result =
-            IOX_POSIX_CALL(iox_shm_open)(
-                nameWithLeadingSlash.c_str(),
-                convertToOflags(m_accessMode,
-                                (m_openMode == OpenMode::OpenOrCreate) ? OpenMode::ExclusiveCreate : m_openMode),
-                m_filePermissions.value())
-                .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
-                .suppressErrorMessagesForErrnos((m_openMode == OpenMode::OpenOrCreate) ? EEXIST : 0)
-                .evaluate();
+            openShm(m_name,
+                    filePath,
+                    convertToOflags(m_accessMode,
+                                    (m_openMode == OpenMode::OpenOrCreate) ? OpenMode::ExclusiveCreate : m_openMode),
+                    m_filePermissions.value(),
+                    (m_openMode == OpenMode::OpenOrCreate) ? EEXIST : 0);
         if (result.has_error())
         {
             // if it was not possible to create the shm exclusively someone else has the
@@ -110,11 +171,11 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
             if (m_openMode == OpenMode::OpenOrCreate && result.error().errnum == EEXIST)
             {
                 hasOwnership = false;
-                result = IOX_POSIX_CALL(iox_shm_open)(nameWithLeadingSlash.c_str(),
-                                                      convertToOflags(m_accessMode, OpenMode::OpenExisting),
-                                                      m_filePermissions.value())
-                             .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
-                             .evaluate();
+                result = openShm(m_name,
+                                 filePath,
+                                 convertToOflags(m_accessMode, OpenMode::OpenExisting),
+                                 m_filePermissions.value(),
+                                 0);
             }
 
             // Check again, as the if-block above may have changed 'result'
@@ -146,25 +207,25 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
                                 << r.getHumanReadableErrnum() << " for SharedMemory \"" << m_name << "\"");
                 });
 
-            IOX_POSIX_CALL(iox_shm_unlink)
-            (nameWithLeadingSlash.c_str())
-                .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
-                .evaluate()
-                .or_else([&](auto&) {
-                    IOX_LOG(Error,
-                            "Unable to remove previously created SharedMemory \""
-                                << m_name << "\". This may be a SharedMemory leak.");
-                });
+            unlinkShm(m_name, filePath).or_else([&](auto&) {
+                IOX_LOG(Error,
+                        "Unable to remove previously created SharedMemory \""
+                            << m_name << "\". This may be a SharedMemory leak.");
+            });
 
             return err(PosixSharedMemory::errnoToEnum(result.error().errnum));
         }
     }
 
-    return ok(PosixSharedMemory(m_name, sharedMemoryFileHandle, hasOwnership));
+    return ok(PosixSharedMemory(m_name, m_mountPoint, sharedMemoryFileHandle, hasOwnership));
 }
 
-PosixSharedMemory::PosixSharedMemory(const Name_t& name, const shm_handle_t handle, const bool hasOwnership) noexcept
+PosixSharedMemory::PosixSharedMemory(const Name_t& name,
+                                     const optional<Path>& mountPoint,
+                                     const shm_handle_t handle,
+                                     const bool hasOwnership) noexcept
     : m_name{name}
+    , m_mountPoint{mountPoint}
     , m_handle{handle}
     , m_hasOwnership{hasOwnership}
 {
@@ -185,6 +246,7 @@ void PosixSharedMemory::reset() noexcept
 {
     m_hasOwnership = false;
     m_name = Name_t();
+    m_mountPoint.reset();
     m_handle = INVALID_HANDLE;
 }
 
@@ -200,6 +262,7 @@ PosixSharedMemory& PosixSharedMemory::operator=(PosixSharedMemory&& rhs) noexcep
         destroy();
 
         m_name = rhs.m_name;
+        m_mountPoint = rhs.m_mountPoint;
         m_hasOwnership = rhs.m_hasOwnership;
         m_handle = rhs.m_handle;
 
@@ -225,12 +288,23 @@ bool PosixSharedMemory::hasOwnership() const noexcept
 
 expected<bool, PosixSharedMemoryError> PosixSharedMemory::unlinkIfExist(const Name_t& name) noexcept
 {
-    auto nameWithLeadingSlash = addLeadingSlash(name);
+    return unlinkIfExist(name, nullopt);
+}
+
+expected<bool, PosixSharedMemoryError> PosixSharedMemory::unlinkIfExist(const Name_t& name,
+                                                                        const optional<Path>& mountPoint) noexcept
+{
+    optional<ShmFilePath_t> filePath;
+    if (mountPoint)
+    {
+        filePath = shmFilePath(*mountPoint, name);
+        if (!filePath)
+        {
+            return err(PosixSharedMemoryError::INVALID_FILE_NAME);
+        }
+    }
 
-    auto result = IOX_POSIX_CALL(iox_shm_unlink)(nameWithLeadingSlash.c_str())
-                      .failureReturnValue(INVALID_HANDLE)
-                      .ignoreErrnos(ENOENT)
-                      .evaluate();
+    auto result = unlinkShm(name, filePath);
 
     if (result.has_error())
     {
@@ -244,7 +318,7 @@ bool PosixSharedMemory::unlink() noexcept
 {
     if (m_hasOwnership)
     {
-        auto unlinkResult = unlinkIfExist(m_name);
+        auto unlinkResult = unlinkIfExist(m_name, m_mountPoint);
         if (unlinkResult.has_error() || !unlinkResult.value())
         {
             IOX_LOG(Error, "Unable to unlink SharedMemory (shm_unlink failed).");
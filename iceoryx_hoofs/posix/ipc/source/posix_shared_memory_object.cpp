@@ -76,7 +76,8 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                     << m_name << ", sizeInBytes = " << m_memorySizeInBytes
                     << ", access mode = " << asStringLiteral(m_accessMode)
                     << ", open mode = " << asStringLiteral(m_openMode) << ", baseAddressHint = " << logBaseAddressHint
-                    << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]");
+                    << ", permissions = " << iox::log::oct(m_permissions.value()) << ", mountPoint = "
+                    << ((m_mountPoint) ? m_mountPoint->as_string().c_str() : "(default)") << " ]");
     };
 
     auto sharedMemory = detail::PosixSharedMemoryBuilder()
@@ -85,6 +86,7 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                             .openMode(m_openMode)
                             .size(m_memorySizeInBytes)
                             .filePermissions(m_permissions)
+                            .mountPoint(m_mountPoint)
                             .create();
 
     if (!sharedMemory)
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_UTILITY_POSIX_NUMA_HPP
+#define IOX_HOOFS_POSIX_UTILITY_POSIX_NUMA_HPP
+
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Returns the NUMA node of the CPU the calling thread is currently running on
+/// @return the NUMA node or nullopt if NUMA is not supported on this platform
+/// @note the thread might be migrated to another NUMA node right after the call
+optional<uint32_t> numaNodeOfCurrentThread() noexcept;
+
+/// @brief Binds the pages which are completely within the provided memory range to a NUMA node. The pages are
+///        allocated on this node once they are touched for the first time.
+/// @param[in] memory is the start of the memory range
+/// @param[in] size is the size of the memory range
+/// @param[in] numaNode is the NUMA node to bind the memory to
+/// @return true if the memory was bound to the NUMA node, false otherwise
+bool bindMemoryToNumaNode(void* const memory, const uint64_t size, const uint32_t numaNode) noexcept;
+} // namespace detail
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_UTILITY_POSIX_NUMA_HPP
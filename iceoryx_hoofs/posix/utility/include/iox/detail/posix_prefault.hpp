@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_POSIX_UTILITY_POSIX_PREFAULT_HPP
+#define IOX_HOOFS_POSIX_UTILITY_POSIX_PREFAULT_HPP
+
+#include "iox/filesystem.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Touches every page of the provided memory range in order to fault it in. This moves the latency of the
+///        page faults from the first access of the memory to the call of this function.
+/// @param[in] memory is the start of the memory range
+/// @param[in] size is the size of the memory range
+/// @param[in] accessMode defines how the pages are touched; with 'ReadOnly' the pages are only read, otherwise every
+///            page is read and the same value is written back which also avoids the later copy-on-write or
+///            write-protection faults
+/// @attention the write access is not atomic; a concurrent write from another thread or process to the same byte
+///            might get lost, therefore 'ReadWrite' must only be used as long as the memory is not yet in use
+void prefaultMemory(void* const memory, const uint64_t size, const AccessMode accessMode) noexcept;
+
+/// @brief Locks the pages of the provided memory range into RAM, i.e. they are faulted in and are not swapped out
+/// @param[in] memory is the start of the memory range
+/// @param[in] size is the size of the memory range
+/// @return true if the memory was locked, false otherwise, e.g. when the limit for locked memory (RLIMIT_MEMLOCK) is
+///         exceeded
+bool lockMemory(void* const memory, const uint64_t size) noexcept;
+
+/// @brief Releases the physical pages of the provided memory range. Only the pages which are completely covered by the
+///        memory range are released. The content of the released pages is lost and they are faulted in with zeros on
+///        the next access.
+/// @param[in] memory is the start of the memory range
+/// @param[in] size is the size of the memory range
+/// @return true if the pages were released, false otherwise, e.g. when the platform does not support it
+bool releaseMemory(void* const memory, const uint64_t size) noexcept;
+} // namespace detail
+} // namespace iox
+
+#endif // IOX_HOOFS_POSIX_UTILITY_POSIX_PREFAULT_HPP
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/posix_numa.hpp"
+#include "iox/detail/system_configuration.hpp"
+#include "iox/logging.hpp"
+#include "iox/memory.hpp"
+#include "iox/posix_call.hpp"
+
+#include "iceoryx_platform/mman.hpp"
+
+namespace iox
+{
+namespace detail
+{
+optional<uint32_t> numaNodeOfCurrentThread() noexcept
+{
+    unsigned int numaNode{0U};
+    if (iox_numa_node_of_current_thread(&numaNode) != 0)
+    {
+        return nullopt;
+    }
+    return static_cast<uint32_t>(numaNode);
+}
+
+bool bindMemoryToNumaNode(void* const memory, const uint64_t size, const uint32_t numaNode) noexcept
+{
+    // mbind works on whole pages; pages which are shared with adjacent memory ranges are left untouched
+    const auto pageSizeOfSystem = pageSize();
+    const auto start = reinterpret_cast<uint64_t>(memory);
+    const auto alignedStart = align(start, pageSizeOfSystem);
+    const auto end = start + size;
+    const auto alignedEnd = end - (end % pageSizeOfSystem);
+    if (alignedEnd <= alignedStart)
+    {
+        return true;
+    }
+
+    auto result = IOX_POSIX_CALL(iox_numa_bind)(
+                      reinterpret_cast<void*>(alignedStart), static_cast<size_t>(alignedEnd - alignedStart), numaNode)
+                      .failureReturnValue(-1)
+                      .evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(Warn,
+                "Unable to bind the memory at " << iox::log::hex(memory) << " with a size of " << size
+                                                << " bytes to the NUMA node " << numaNode << " since \""
+                                                << result.error().getHumanReadableErrnum() << "\"");
+        return false;
+    }
+    return true;
+}
+} // namespace detail
+} // namespace iox
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/posix_prefault.hpp"
+#include "iox/detail/system_configuration.hpp"
+#include "iox/logging.hpp"
+#include "iox/memory.hpp"
+#include "iox/posix_call.hpp"
+
+#include "iceoryx_platform/mman.hpp"
+
+namespace iox
+{
+namespace detail
+{
+void prefaultMemory(void* const memory, const uint64_t size, const AccessMode accessMode) noexcept
+{
+    if (memory == nullptr || size == 0U)
+    {
+        return;
+    }
+
+    // the accesses must not be optimized away, therefore the memory is accessed via a pointer to volatile
+    volatile uint8_t* const bytes = static_cast<volatile uint8_t*>(memory);
+    const auto pageSizeOfSystem = pageSize();
+    const auto firstPageOffset = reinterpret_cast<uint64_t>(memory) % pageSizeOfSystem;
+    const bool writeAccess = accessMode != AccessMode::ReadOnly;
+
+    // one access per page is sufficient; the first byte of the range is touched separately since it usually does
+    // not start at a page boundary
+    for (uint64_t offset = 0U; offset < size; offset = (offset == 0U) ? pageSizeOfSystem - firstPageOffset
+                                                                      : offset + pageSizeOfSystem)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) memory range is provided by the caller
+        const uint8_t value = bytes[offset];
+        if (writeAccess)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) memory range is provided by the caller
+            bytes[offset] = value;
+        }
+    }
+}
+
+bool lockMemory(void* const memory, const uint64_t size) noexcept
+{
+    if (memory == nullptr || size == 0U)
+    {
+        return true;
+    }
+
+    auto result = IOX_POSIX_CALL(iox_mlock)(memory, static_cast<size_t>(size)).failureReturnValue(-1).evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(Warn,
+                "Unable to lock the memory at " << iox::log::hex(memory) << " with a size of " << size
+                                                << " bytes since \"" << result.error().getHumanReadableErrnum()
+                                                << "\"");
+        return false;
+    }
+    return true;
+}
+
+bool releaseMemory(void* const memory, const uint64_t size) noexcept
+{
+    const auto pageSizeOfSystem = pageSize();
+    const auto begin = align(reinterpret_cast<uint64_t>(memory), pageSizeOfSystem);
+    const auto end = reinterpret_cast<uint64_t>(memory) + size;
+    const auto length = (end > begin) ? ((end - begin) / pageSizeOfSystem) * pageSizeOfSystem : 0U;
+    if (memory == nullptr || length == 0U)
+    {
+        return false;
+    }
+
+    // NOLINTNEXTLINE(performance-no-int-to-ptr) the address is obtained from a valid pointer
+    auto* const firstPage = reinterpret_cast<void*>(begin);
+    auto result =
+        IOX_POSIX_CALL(iox_release_memory)(firstPage, static_cast<size_t>(length)).failureReturnValue(-1).evaluate();
+    if (result.has_error())
+    {
+        if (result.error().errnum != ENOSYS)
+        {
+            IOX_LOG(Warn,
+                    "Unable to release the memory at " << iox::log::hex(firstPage) << " with a size of " << length
+                                                       << " bytes since \"" << result.error().getHumanReadableErrnum()
+                                                       << "\"");
+        }
+        return false;
+    }
+    return true;
+}
+} // namespace detail
+} // namespace iox
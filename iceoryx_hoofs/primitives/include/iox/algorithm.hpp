@@ -236,6 +236,27 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Counts the zero bits below the lowest set bit, i.e. returns the index of the lowest set bit
+/// @return the number of trailing zero bits, 64 if the value is zero
+inline uint64_t countTrailingZeros(const uint64_t value) noexcept
+{
+    constexpr uint64_t NUMBER_OF_BITS{64U};
+    if (value == 0U)
+    {
+        return NUMBER_OF_BITS;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t numberOfTrailingZeros{0U};
+    for (uint64_t remainder = value; (remainder & 1U) == 0U; remainder >>= 1U)
+    {
+        ++numberOfTrailingZeros;
+    }
+    return numberOfTrailingZeros;
+#endif
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
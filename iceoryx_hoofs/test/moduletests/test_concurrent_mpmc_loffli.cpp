@@ -221,4 +221,95 @@ TEST_F(MpmcLoFFLi_test, PushToUninitializedLoFFLi)
     MpmcLoFFLi loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TEST_F(MpmcLoFFLi_test, BulkPopAcquiresRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17595479-a560-4d38-88f8-a59a55cac06f");
+    constexpr uint32_t NUMBER_OF_INDICES{CAPACITY - 1};
+    std::vector<uint32_t> indices(CAPACITY, 0);
+
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+    for (uint32_t i = 0; i < NUMBER_OF_INDICES; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(CAPACITY - 1));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPopIsLimitedByAvailableIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f732acfc-0a18-4631-98d1-89d517bb1ada");
+    std::vector<uint32_t> indices(2 * CAPACITY, 0);
+
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), 2 * CAPACITY), Eq(CAPACITY));
+    EXPECT_THAT(this->m_loffli.pop(indices.data(), 2 * CAPACITY), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPopFromUninitializedLoFFLiFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "120e4fed-6efd-420c-b4ad-7509f7a111f2");
+    std::vector<uint32_t> indices(CAPACITY, 0);
+
+    MpmcLoFFLi loFFLi;
+    EXPECT_THAT(loFFLi.pop(indices.data(), CAPACITY), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPushMakesAllIndicesAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6cf5f52d-7fee-4868-a018-693e716a503c");
+    std::vector<uint32_t> useListToPush(CAPACITY, 0);
+    ASSERT_THAT(this->m_loffli.pop(useListToPush.data(), CAPACITY), Eq(CAPACITY));
+
+    std::random_device randomDevice;
+    std::default_random_engine randomEngine(randomDevice());
+    std::shuffle(useListToPush.begin(), useListToPush.end(), randomEngine);
+
+    EXPECT_THAT(this->m_loffli.push(useListToPush.data(), CAPACITY), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+
+    EXPECT_THAT(useListPoped, Eq(useListToPush));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPushWithDuplicateIndexFailsWithoutPushingAnything)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a4cb63c-d261-4008-bca7-3324c9770510");
+    std::vector<uint32_t> indices(CAPACITY, 0);
+    ASSERT_THAT(this->m_loffli.pop(indices.data(), CAPACITY), Eq(CAPACITY));
+    indices[CAPACITY - 1] = indices[0];
+
+    EXPECT_THAT(this->m_loffli.push(indices.data(), CAPACITY), Eq(false));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indices.data(), CAPACITY - 1), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPushWithIndexWhichIsNotPopedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da688e2e-46ad-4598-a60b-7f0cbaee4794");
+    std::vector<uint32_t> indices(2, 0);
+    ASSERT_THAT(this->m_loffli.pop(indices.data(), 1), Eq(1U));
+    indices[1] = indices[0] + 1;
+
+    EXPECT_THAT(this->m_loffli.push(indices.data(), 2), Eq(false));
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+}
+
+TEST_F(MpmcLoFFLi_test, BulkPushToUninitializedLoFFLiFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ff1ca717-04bf-4e37-9ff2-813c13db198d");
+    uint32_t index{0};
+    MpmcLoFFLi loFFLi;
+    EXPECT_THAT(loFFLi.push(&index, 1), Eq(false));
+}
 } // namespace
@@ -2625,6 +2625,50 @@ TEST_F(FixedPositionContainer_test, IterFromIndexWithValidIndexReturnsIteratorTo
 // END test iter_from_index
 
 
+// BEGIN test iter_from_ptr
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerToEmptySlotReturnsEndIterator)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3513f53f-db10-46b3-8bcc-56b6db8125ef");
+
+    fillSut();
+    const auto* ptr = sut.iter_from_index(Sut::Index::LAST / 2U).to_ptr();
+    sut.erase(Sut::Index::LAST / 2U);
+
+    EXPECT_THAT(sut.iter_from_ptr(ptr), Eq(sut.end()));
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerOutOfContainerReturnsEndIterator)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "80df2730-f8f7-4987-9459-bf029b685926");
+
+    fillSut();
+    DataType value{0U};
+
+    auto* ptr_first = sut.begin().to_ptr();
+    // NOLINTJUSTIFICATION required for test
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    auto* ptr_unaligned = reinterpret_cast<DataType*>(reinterpret_cast<uintptr_t>(ptr_first) + 1U);
+
+    EXPECT_THAT(sut.iter_from_ptr(&value), Eq(sut.end()));
+    EXPECT_THAT(sut.iter_from_ptr(ptr_unaligned), Eq(sut.end()));
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerToElementReturnsIteratorToElement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ecdf12c-6d95-4a5d-97d8-d9ea7452a957");
+
+    fillSut();
+    const auto* ptr = sut.iter_from_index(Sut::Index::LAST / 2U).to_ptr();
+
+    auto it = sut.iter_from_ptr(ptr);
+    EXPECT_THAT(it.to_index(), Eq(Sut::Index::LAST / 2U));
+    EXPECT_THAT(it.to_ptr(), Eq(ptr));
+}
+
+// END test iter_from_ptr
+
+
 // BEGIN test iterator
 
 TEST_F(FixedPositionContainer_test, NewlyCreatedContainerHasEndIteratorPointingToEnd)
@@ -17,10 +17,12 @@
 
 #include "test.hpp"
 
+#include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/stat.hpp"
 #include "iceoryx_platform/unistd.hpp"
 #include "iox/detail/posix_shared_memory.hpp"
+#include "iox/path.hpp"
 #include "iox/posix_call.hpp"
 
 #include <fcntl.h>
@@ -263,5 +265,73 @@ TEST_F(PosixSharedMemory_Test, OpenFailsWhenCreatingShmInReadOnlyMode)
     ASSERT_THAT(sut.error(), Eq(PosixSharedMemoryError::INCOMPATIBLE_OPEN_AND_ACCESS_MODE));
 }
 
+TEST_F(PosixSharedMemory_Test, CreateWithMountPointCreatesAndRemovesFileInMountPoint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b3c6d7e-2a4f-4b8e-9f6d-8e1c2b3a4d5f");
+    const auto mountPoint = Path::create(platform::IOX_TEMP_DIR).expect("invalid temp dir");
+    const std::string filePath = std::string(platform::IOX_TEMP_DIR) + "/" + SUT_SHM_NAME;
+    iox_stat fileStatus;
+
+    {
+        auto sut = PosixSharedMemoryBuilder()
+                       .name(SUT_SHM_NAME)
+                       .accessMode(iox::AccessMode::ReadWrite)
+                       .openMode(iox::OpenMode::PurgeAndCreate)
+                       .filePermissions(perms::owner_all)
+                       .size(128)
+                       .mountPoint(mountPoint)
+                       .create();
+        ASSERT_FALSE(sut.has_error());
+
+        ASSERT_THAT(stat(filePath.c_str(), &fileStatus), Eq(0));
+        EXPECT_THAT(fileStatus.st_size, Eq(128));
+        auto sutFromDefaultFileSystem = createSut(SUT_SHM_NAME, iox::OpenMode::OpenExisting);
+        EXPECT_TRUE(sutFromDefaultFileSystem.has_error());
+    }
+
+    EXPECT_THAT(stat(filePath.c_str(), &fileStatus), Ne(0));
+}
+
+TEST_F(PosixSharedMemory_Test, OpenWithMountPointWorksWhenShmInMountPointExists)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1e9d2c-5f3b-4c7a-8e2d-1b9f0c4a7e63");
+    const auto mountPoint = Path::create(platform::IOX_TEMP_DIR).expect("invalid temp dir");
+    auto createShm = [&](const iox::OpenMode openMode) {
+        return PosixSharedMemoryBuilder()
+            .name(SUT_SHM_NAME)
+            .accessMode(iox::AccessMode::ReadWrite)
+            .openMode(openMode)
+            .filePermissions(perms::owner_all)
+            .size(128)
+            .mountPoint(mountPoint)
+            .create();
+    };
+
+    auto sut = createShm(iox::OpenMode::PurgeAndCreate);
+    ASSERT_FALSE(sut.has_error());
+    auto sut2 = createShm(iox::OpenMode::OpenExisting);
+    ASSERT_FALSE(sut2.has_error());
+    EXPECT_FALSE(sut2->hasOwnership());
+}
+
+TEST_F(PosixSharedMemory_Test, UnlinkIfExistWithMountPointRemovesShmFromMountPoint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4d8e2f1-7b6a-4d3e-9a5c-2f8b1e0d6c97");
+    const auto mountPoint = Path::create(platform::IOX_TEMP_DIR).expect("invalid temp dir");
+    const std::string filePath = std::string(platform::IOX_TEMP_DIR) + "/" + SUT_SHM_NAME;
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) enum types defined by POSIX are required
+    auto fd = iox_open(filePath.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    ASSERT_THAT(fd, Ne(-1));
+    iox_close(fd);
+
+    auto result = PosixSharedMemory::unlinkIfExist(SUT_SHM_NAME, mountPoint);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(*result);
+
+    result = PosixSharedMemory::unlinkIfExist(SUT_SHM_NAME, mountPoint);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(*result);
+}
+
 
 } // namespace
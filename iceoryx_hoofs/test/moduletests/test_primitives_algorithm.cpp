@@ -226,4 +226,19 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST_F(algorithm_test, CountTrailingZerosOfZeroIsNumberOfBits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0476103d-cfa1-4326-ac8b-49f09e1f7cbc");
+    EXPECT_THAT(countTrailingZeros(0U), Eq(64U));
+}
+
+TEST_F(algorithm_test, CountTrailingZerosReturnsIndexOfLowestSetBit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d123611-ffda-43ed-9c3c-3d9be3a43d24");
+    EXPECT_THAT(countTrailingZeros(1U), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(0b101000U), Eq(3U));
+    EXPECT_THAT(countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(1ULL << 63U), Eq(63U));
+}
 } // namespace
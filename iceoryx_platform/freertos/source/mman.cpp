@@ -86,3 +86,27 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_numa_bind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_current_thread(unsigned int*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_release_memory(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/// @brief the futex can be used as wait primitive in shared memory
+constexpr bool IOX_FUTEX_AVAILABLE = true;
+
+/// @brief blocks as long as the futex word contains the expected value
+/// @param[in] futexWord the 32 bit word in (shared) memory
+/// @param[in] expectedValue the caller blocks only when the futex word still contains this value
+/// @param[in] relativeTimeout the maximum time to block, nullptr blocks without timeout
+/// @return 0 when woken up, otherwise -1 and errno is set, e.g. to EAGAIN when the value differs or ETIMEDOUT
+inline int iox_futex_wait(uint32_t* futexWord, const uint32_t expectedValue, const struct timespec* relativeTimeout)
+{
+    return static_cast<int>(syscall(SYS_futex, futexWord, FUTEX_WAIT, expectedValue, relativeTimeout, nullptr, 0));
+}
+
+/// @brief wakes up callers which block in iox_futex_wait on the futex word
+/// @param[in] futexWord the 32 bit word in (shared) memory
+/// @param[in] numberOfWaiters the maximum number of callers to wake up
+/// @return the number of woken up callers, otherwise -1 and errno is set
+inline int iox_futex_wake(uint32_t* futexWord, const uint32_t numberOfWaiters)
+{
+    return static_cast<int>(syscall(SYS_futex, futexWord, FUTEX_WAKE, numberOfWaiters, nullptr, nullptr, 0));
+}
+
+#endif // IOX_HOOFS_LINUX_PLATFORM_FUTEX_HPP
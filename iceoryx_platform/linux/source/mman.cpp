@@ -16,8 +16,18 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <sys/syscall.h>
 #include <unistd.h>
 
+namespace
+{
+/// @brief MPOL_BIND from linux/mempolicy.h which is not available without the libnuma headers
+constexpr int IOX_MPOL_BIND{2};
+constexpr unsigned int BITS_PER_NODE_MASK_ENTRY{sizeof(unsigned long) * 8U};
+constexpr unsigned int MAX_NUMA_NODES{1024U};
+} // namespace
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
@@ -34,3 +44,43 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_numa_bind(void* addr, size_t length, unsigned int node)
+{
+    if (node >= MAX_NUMA_NODES)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    unsigned long nodeMask[MAX_NUMA_NODES / BITS_PER_NODE_MASK_ENTRY] = {};
+    nodeMask[node / BITS_PER_NODE_MASK_ENTRY] = 1UL << (node % BITS_PER_NODE_MASK_ENTRY);
+    // the kernel expects the number of bits of the mask plus one
+    return static_cast<int>(syscall(SYS_mbind, addr, length, IOX_MPOL_BIND, &nodeMask[0], MAX_NUMA_NODES + 1U, 0U));
+}
+
+int iox_numa_node_of_current_thread(unsigned int* node)
+{
+    unsigned int cpu{0U};
+    return static_cast<int>(syscall(SYS_getcpu, &cpu, node, nullptr));
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_release_memory(void* addr, size_t length)
+{
+    // MADV_REMOVE frees the backing pages of shared memory; MADV_DONTNEED only drops the mapping of the calling
+    // process and is used for memory which does not support hole punching
+    if (madvise(addr, length, MADV_REMOVE) == 0)
+    {
+        return 0;
+    }
+    if (errno != EINVAL && errno != EOPNOTSUPP)
+    {
+        return -1;
+    }
+    return madvise(addr, length, MADV_DONTNEED);
+}
@@ -23,4 +23,18 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief binds the memory range to a NUMA node; the pages which are not yet faulted in are allocated on this node
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when NUMA is not supported on this platform
+int iox_numa_bind(void* addr, size_t length, unsigned int node);
+/// @brief acquires the NUMA node of the CPU the calling thread is currently running on
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when NUMA is not supported on this platform
+int iox_numa_node_of_current_thread(unsigned int* node);
+/// @brief locks the memory range into RAM and faults in all of its pages
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when locking memory is not supported on this platform
+int iox_mlock(const void* addr, size_t length);
+/// @brief releases the physical pages of the memory range; the content is lost and the pages are faulted in with
+/// zeros on the next access
+/// @return 0 on success, otherwise -1 and errno is set; ENOSYS when releasing memory is not supported on this platform
+int iox_release_memory(void* addr, size_t length);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_MMAN_HPP
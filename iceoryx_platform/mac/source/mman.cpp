@@ -43,3 +43,26 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_numa_bind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_current_thread(unsigned int*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_release_memory(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
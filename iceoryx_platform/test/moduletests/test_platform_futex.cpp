@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/futex.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+
+constexpr int IOX_TEST_RET_NOK{-1};
+
+TEST(FUTEX_test, WaitReturnsImmediatelyWhenFutexWordDiffersFromExpectedValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4fc2f485-f855-4fc7-8c1e-cc047e495cd7");
+    if (!IOX_FUTEX_AVAILABLE)
+    {
+        GTEST_SKIP() << "The futex is not available on this platform";
+    }
+
+    uint32_t futexWord{1U};
+
+    EXPECT_THAT(iox_futex_wait(&futexWord, 0U, nullptr), Eq(IOX_TEST_RET_NOK));
+    EXPECT_THAT(errno, Eq(EAGAIN));
+}
+
+TEST(FUTEX_test, WaitReturnsAfterTimeoutWithoutWakeUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28f6a1d4-65a2-4122-9c0b-c1b0d816e9a2");
+    if (!IOX_FUTEX_AVAILABLE)
+    {
+        GTEST_SKIP() << "The futex is not available on this platform";
+    }
+
+    uint32_t futexWord{0U};
+    struct timespec timeout = {0, 1000000};
+
+    EXPECT_THAT(iox_futex_wait(&futexWord, 0U, &timeout), Eq(IOX_TEST_RET_NOK));
+    EXPECT_THAT(errno, Eq(ETIMEDOUT));
+}
+
+TEST(FUTEX_test, WakeUnblocksWaitingThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb7d814e-0928-491d-a937-f10132325339");
+    if (!IOX_FUTEX_AVAILABLE)
+    {
+        GTEST_SKIP() << "The futex is not available on this platform";
+    }
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32 bit word");
+    std::atomic<uint32_t> futexWord{0U};
+    std::atomic<bool> isWokenUp{false};
+    std::thread waiter([&] {
+        // spurious wake-ups are possible, therefore the futex word is checked after every return
+        while (futexWord.load() == 0U)
+        {
+            iox_futex_wait(reinterpret_cast<uint32_t*>(&futexWord), 0U, nullptr);
+        }
+        isWokenUp = true;
+    });
+
+    futexWord.store(1U);
+    EXPECT_THAT(iox_futex_wake(reinterpret_cast<uint32_t*>(&futexWord), 1U), Ge(0));
+    waiter.join();
+
+    EXPECT_TRUE(isWokenUp.load());
+}
+} // namespace
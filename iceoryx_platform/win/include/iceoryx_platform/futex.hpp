@@ -0,0 +1,39 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_WIN_PLATFORM_FUTEX_HPP
+#define IOX_HOOFS_WIN_PLATFORM_FUTEX_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+
+/// @brief there is no futex on this platform, the semaphore is used as wait primitive instead
+constexpr bool IOX_FUTEX_AVAILABLE = false;
+
+inline int iox_futex_wait(uint32_t*, const uint32_t, const struct timespec*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+inline int iox_futex_wake(uint32_t*, const uint32_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif // IOX_HOOFS_WIN_PLATFORM_FUTEX_HPP
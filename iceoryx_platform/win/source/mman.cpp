@@ -266,3 +266,27 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_numa_bind(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_numa_node_of_current_thread(unsigned int*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_release_memory(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -62,7 +62,7 @@ configure_option(
 )
 configure_option(
     NAME IOX_MAX_PUBLISHER_HISTORY
-    DEFAULT_VALUE 16
+    DEFAULT_VALUE 64
 )
 configure_option(
     NAME IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY
@@ -68,6 +68,10 @@ class NodeBuilder
     /// tests
     IOX_BUILDER_PARAMETER(bool, shares_address_space_with_roudi, false)
 
+    /// @brief Indicates whether all pages of the shared memory are faulted in when the node is created in order to
+    /// prevent page faults on the first access to the memory
+    IOX_BUILDER_PARAMETER(bool, prefault_shared_memory, false)
+
   public:
     /// @brief Determines which domain to use to register to a RouDi instance
     /// @param[in] domain_id to be used as domain ID
@@ -121,7 +121,8 @@ expected<Node, NodeBuilderError> NodeBuilder::create() noexcept
             runtime::SharedMemoryUser::create(domain_id,
                                               ipcRuntimeInterface.getSegmentId(),
                                               ipcRuntimeInterface.getShmTopicSize(),
-                                              ipcRuntimeInterface.getSegmentManagerAddressOffset())
+                                              ipcRuntimeInterface.getSegmentManagerAddressOffset(),
+                                              m_prefault_shared_memory)
                 .and_then([&shmInterface](auto& value) { shmInterface.emplace(std::move(value)); });
         if (shmInterfaceResult.has_error())
         {
@@ -65,6 +65,8 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+/// @brief maximum number of chunks a publisher keeps in its broadcast ring, see PublisherOptions::broadcastRingCapacity
+constexpr uint64_t MAX_BROADCAST_RING_CAPACITY = 64U;
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
@@ -119,6 +121,8 @@ constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
+/// @brief number of chunks a port can cache in front of a mempool when the chunk magazine is enabled
+constexpr uint32_t MEMPOOL_MAGAZINE_CAPACITY = 8U;
 
 constexpr uint32_t CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT{8U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_SIZE{0U};
@@ -291,6 +295,9 @@ constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief the upper limit of threads which are used to fault in the shared memory at startup
+constexpr uint32_t MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS{64U};
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -304,6 +311,19 @@ enum class MonitoringMode
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
+
+/// @brief Controls how RouDi prepares the shared memory at startup
+/// OFF - the pages are faulted in on first access by the applications
+/// PREFAULT - all pages are faulted in at startup
+/// LOCK - all pages are faulted in at startup and locked into RAM
+enum class MemoryPrefaultMode
+{
+    OFF,
+    PREFAULT,
+    LOCK
+};
+
+iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MemoryPrefaultMode& mode) noexcept;
 } // namespace roudi
 
 namespace mepoo
@@ -68,6 +68,26 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     }
     return logstream;
 }
+
+inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MemoryPrefaultMode& mode) noexcept
+{
+    switch (mode)
+    {
+    case MemoryPrefaultMode::OFF:
+        logstream << "MemoryPrefaultMode::OFF";
+        break;
+    case MemoryPrefaultMode::PREFAULT:
+        logstream << "MemoryPrefaultMode::PREFAULT";
+        break;
+    case MemoryPrefaultMode::LOCK:
+        logstream << "MemoryPrefaultMode::LOCK";
+        break;
+    default:
+        logstream << "MemoryPrefaultMode::UNDEFINED";
+        break;
+    }
+    return logstream;
+}
 } // namespace roudi
 
 } // namespace iox
@@ -0,0 +1,112 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_BUDDY_ALLOCATOR_HPP
+#define IOX_POSH_MEPOO_BUDDY_ALLOCATOR_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/optional.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Manages the blocks of a buddy allocator by the index of their first unit. A block of order k consists of
+///        2^k consecutive units and starts at a unit index which is a multiple of 2^k. On allocation, the smallest free
+///        block with a sufficient order is split in halves until it has the requested order. On release, a block is
+///        merged with its buddy as long as the buddy is free and has the same order.
+///        All data is placed in the management memory and referenced by relative pointers, therefore the
+///        BuddyAllocator can be shared between processes. The operations are guarded by a spin lock. The critical
+///        section has an upper bound of O(maxOrder) steps and contains neither system calls nor allocations.
+/// @note the BuddyAllocator only hands out unit indices; the memory of the units is managed by the MemPool
+class BuddyAllocator
+{
+  public:
+    using Index_t = uint32_t;
+
+    /// @brief the number of units must fit into an Index_t, therefore the order is limited as well
+    static constexpr uint32_t MAX_NUMBER_OF_ORDERS{32U};
+
+    /// @brief Creates a BuddyAllocator
+    /// @param[in] numberOfUnits is the number of units; must be a multiple of 2^maxOrder
+    /// @param[in] maxOrder is the order of the largest block
+    /// @param[in] managementAllocator is used to allocate the memory for the state of the units and the free lists
+    BuddyAllocator(const uint32_t numberOfUnits, const uint32_t maxOrder, BumpAllocator& managementAllocator) noexcept;
+
+    BuddyAllocator(const BuddyAllocator&) = delete;
+    BuddyAllocator(BuddyAllocator&&) = delete;
+    BuddyAllocator& operator=(const BuddyAllocator&) = delete;
+    BuddyAllocator& operator=(BuddyAllocator&&) = delete;
+    ~BuddyAllocator() noexcept = default;
+
+    /// @brief Returns the size of the management memory which is allocated by the constructor
+    /// @param[in] numberOfUnits is the number of units
+    /// @return the required management memory in bytes
+    static uint64_t requiredManagementMemorySize(const uint32_t numberOfUnits) noexcept;
+
+    /// @brief Returns the smallest order whose block has at least the provided number of units
+    /// @param[in] numberOfUnits is the minimal number of units of the block
+    /// @return the order of the block; MAX_NUMBER_OF_ORDERS if the number of units exceeds the largest possible block
+    static uint32_t orderForNumberOfUnits(const uint64_t numberOfUnits) noexcept;
+
+    /// @brief Allocates a block
+    /// @param[in] order of the block to allocate
+    /// @return the index of the first unit of the block or nullopt if there is no free block with a sufficient order
+    optional<Index_t> allocate(const uint32_t order) noexcept;
+
+    /// @brief Releases a block which was acquired with 'allocate'
+    /// @param[in] index of the first unit of the block
+    /// @return the order of the released block or nullopt if the index does not belong to an allocated block, e.g. in
+    /// case of a double free
+    optional<uint32_t> deallocate(const Index_t index) noexcept;
+
+    uint32_t getNumberOfUnits() const noexcept;
+    uint32_t getMaxOrder() const noexcept;
+
+  private:
+    using State_t = uint8_t;
+    static constexpr State_t STATE_ORDER_MASK{0x3FU};
+    static constexpr State_t STATE_FREE{0x40U};
+    static constexpr State_t STATE_ALLOCATED{0x80U};
+    static constexpr State_t STATE_NONE{0U};
+    static constexpr Index_t INVALID_INDEX{std::numeric_limits<Index_t>::max()};
+
+    void lock() noexcept;
+    void unlock() noexcept;
+    void pushToFreeList(const uint32_t order, const Index_t index) noexcept;
+    void removeFromFreeList(const uint32_t order, const Index_t index) noexcept;
+
+    concurrent::AtomicFlag m_lock = ATOMIC_FLAG_INIT; // NOTE: only initialization via assignment is guaranteed to work
+    uint32_t m_numberOfUnits{0U};
+    uint32_t m_maxOrder{0U};
+    Index_t m_freeListHeads[MAX_NUMBER_OF_ORDERS];
+
+    /// @brief the state of a unit; only the first unit of a block has a state other than STATE_NONE
+    RelativePointer<State_t> m_states;
+    /// @brief the links of the doubly linked free lists; only valid for the first unit of a free block
+    RelativePointer<Index_t> m_nextFree;
+    RelativePointer<Index_t> m_previousFree;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_BUDDY_ALLOCATOR_HPP
@@ -40,6 +40,13 @@ struct ChunkManagement
                     const not_null<MemPool*> mempool,
                     const not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief Constructs a ChunkManagement which is embedded at the start of the chunk it manages; it has no chunk
+    /// management pool and is released together with the chunk
+    ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept;
+
+    /// @brief Returns true if the ChunkManagement is embedded in the chunk
+    bool isEmbeddedInChunk() const noexcept;
+
     iox::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
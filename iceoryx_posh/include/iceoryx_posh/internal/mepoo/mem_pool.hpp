@@ -18,11 +18,13 @@
 #ifndef IOX_POSH_MEPOO_MEM_POOL_HPP
 #define IOX_POSH_MEPOO_MEM_POOL_HPP
 
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/atomic.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
+#include "iox/optional.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include <cstdint>
@@ -37,12 +39,17 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint64_t chunkSize) noexcept;
+                const uint64_t chunkSize,
+                const optional<uint32_t> numaNode = nullopt) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
+    optional<uint32_t> m_numaNode;
+    uint32_t m_numOverflowChunks{0};
+    uint32_t m_usedOverflowChunks{0};
+    uint64_t m_leakedChunks{0};
 };
 
 class MemPool
@@ -51,10 +58,36 @@ class MemPool
     using freeList_t = concurrent::MpmcLoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
 
+    /// @brief Creates a MemPool
+    /// @param[in] chunkSize is the size of each chunk including the ChunkHeader
+    /// @param[in] numberOfChunks is the number of chunks of the MemPool
+    /// @param[in] managementAllocator is used to allocate the memory for the free list
+    /// @param[in] chunkMemoryAllocator is used to allocate the memory for the chunks
+    /// @param[in] numaNode is the NUMA node the chunk memory is bound to; no binding if not set
+    /// @param[in] numberOfOverflowChunks is the number of additional chunks which are only used when all regular
+    /// chunks are in use; their memory is released with 'releaseIdleOverflowMemory' once they are idle again
     MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const greater_or_equal<uint32_t, 1> numberOfChunks,
             iox::BumpAllocator& managementAllocator,
-            iox::BumpAllocator& chunkMemoryAllocator) noexcept;
+            iox::BumpAllocator& chunkMemoryAllocator,
+            const optional<uint32_t> numaNode = nullopt,
+            const uint32_t numberOfOverflowChunks = 0U) noexcept;
+
+    /// @brief Creates a MemPool whose chunks are the blocks of a buddy allocator, i.e. the chunk size is a power of two
+    /// multiple of the minimal chunk size
+    /// @param[in] minChunkSize is the size of the smallest chunk including the ChunkHeader
+    /// @param[in] numberOfMinChunks is the number of the smallest chunks which fit into the chunk memory; must be a
+    /// multiple of 2^maxOrder
+    /// @param[in] maxOrder defines the size of the largest chunk, which is minChunkSize * 2^maxOrder
+    /// @param[in] managementAllocator is used to allocate the memory for the buddy allocator
+    /// @param[in] chunkMemoryAllocator is used to allocate the memory for the chunks
+    /// @param[in] numaNode is the NUMA node the chunk memory is bound to; no binding if not set
+    MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> minChunkSize,
+            const greater_or_equal<uint32_t, 1> numberOfMinChunks,
+            const uint32_t maxOrder,
+            iox::BumpAllocator& managementAllocator,
+            iox::BumpAllocator& chunkMemoryAllocator,
+            const optional<uint32_t> numaNode = nullopt) noexcept;
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
@@ -62,14 +95,79 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief Obtains a chunk with at least the required size
+    /// @param[in] requiredChunkSize is the minimal size of the chunk including the ChunkHeader
+    /// @return a pointer to the chunk or a nullptr if the MemPool has no fitting chunk left
+    /// @note the size of the chunk is given by 'getChunkSizeFor(requiredChunkSize)'
+    void* getChunk(const uint64_t requiredChunkSize) noexcept;
+
+    /// @brief Returns the size of the chunk which is obtained by 'getChunk(requiredChunkSize)'
+    /// @param[in] requiredChunkSize is the minimal size of the chunk including the ChunkHeader
+    /// @return the chunk size or 0 if the required chunk size exceeds the maximum chunk size
+    uint64_t getChunkSizeFor(const uint64_t requiredChunkSize) const noexcept;
+
+    /// @brief Returns the size of the largest chunk; for a MemPool with fixed size chunks this is the chunk size
+    uint64_t getMaxChunkSize() const noexcept;
+
+    /// @brief Returns true if the chunks are the blocks of a buddy allocator
+    bool isBuddyMemPool() const noexcept;
+
+    /// @brief Returns the chunk size for a MemPool with fixed size chunks and the smallest chunk size for a buddy
+    /// MemPool; the number of chunks and the used chunks of a buddy MemPool are counted in units of this size
     uint64_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Obtains one of the overflow chunks; these are not used by 'getChunk' and 'getChunks'
+    /// @return a pointer to the chunk or a nullptr if the MemPool has no overflow chunk left or the overflow memory is
+    /// currently released
+    void* getOverflowChunk() noexcept;
+
+    /// @brief Releases the physical pages of the overflow chunks if none of them was obtained since the last call and
+    /// none of them is in use
+    /// @return true if the overflow memory was released, false otherwise
+    /// @note must only be called from one thread, e.g. the RouDi monitoring loop
+    bool releaseIdleOverflowMemory() noexcept;
+
+    /// @brief Returns the number of overflow chunks
+    uint32_t getOverflowChunkCount() const noexcept;
+
+    /// @brief Returns the number of overflow chunks which are currently in use
+    uint32_t getUsedOverflowChunks() const noexcept;
+
+    /// @brief Accounts a chunk which was leaked by a terminated application and reclaimed by RouDi
+    void incrementLeakedChunks() noexcept;
+
+    /// @brief Returns the number of chunks which were leaked by terminated applications and reclaimed by RouDi
+    uint64_t getLeakedChunks() const noexcept;
+
+    /// @brief Returns the NUMA node the chunk memory is bound to
+    /// @return the NUMA node or nullopt if the chunk memory is not bound to a NUMA node
+    optional<uint32_t> getNumaNode() const noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Acquires multiple chunks with one operation on the free list and on the usage counters
+    /// @param[out] chunkIndices is a pointer to an array with at least maxNumberOfChunks elements
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to acquire
+    /// @return the number of acquired chunks whose indices are stored at the front of chunkIndices
+    /// @note the chunks are accounted as used until they are returned with 'freeChunks' or 'freeChunk'
+    uint32_t getChunks(uint32_t* const chunkIndices, const uint32_t maxNumberOfChunks) noexcept;
+
+    /// @brief Returns multiple chunks, which were acquired with 'getChunks', with one operation on the free list and
+    /// on the usage counters
+    /// @param[in] chunkIndices is a pointer to an array with numberOfChunks indices
+    /// @param[in] numberOfChunks is the number of chunks to return
+    void freeChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Converts the index of a chunk of this MemPool, e.g. acquired with 'getChunks', to a pointer
+    /// @param[in] index of the chunk
+    /// @return the pointer to the chunk
+    void* chunkFromIndex(const uint32_t index) const noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
@@ -88,6 +186,13 @@ class MemPool
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint64_t value) const noexcept;
+    void allocateChunkMemory(iox::BumpAllocator& chunkMemoryAllocator) noexcept;
+    void reportInvalidChunkSize() const noexcept;
+    void freeBuddyChunk(const uint32_t index) noexcept;
+    void freeOverflowChunk(const uint32_t index) noexcept;
+
+    /// @brief is set in m_usedOverflowChunks while the overflow memory is released to block 'getOverflowChunk'
+    static constexpr uint32_t RELEASING_OVERFLOW_MEMORY{1U << 31U};
 
     RelativePointer<void> m_rawMemory;
 
@@ -95,11 +200,25 @@ class MemPool
     /// needs to be 32 bit since loffli supports only 32 bit numbers
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
+    optional<uint32_t> m_numaNode;
 
     concurrent::Atomic<uint32_t> m_usedChunks{0U};
     concurrent::Atomic<uint32_t> m_minFree{0U};
+    concurrent::Atomic<uint64_t> m_leakedChunks{0U};
 
     freeList_t m_freeIndices;
+
+    /// @brief only set for a buddy MemPool
+    RelativePointer<BuddyAllocator> m_buddyAllocator;
+
+    /// @brief the overflow chunks follow the regular chunks in the chunk memory; their indices in the free list are
+    /// offset by m_numberOfChunks
+    uint32_t m_numberOfOverflowChunks{0U};
+    concurrent::Atomic<uint32_t> m_usedOverflowChunks{0U};
+    concurrent::Atomic<bool> m_overflowChunkObtained{false};
+    /// @brief only accessed by 'releaseIdleOverflowMemory'; initially set since the memory might be prefaulted
+    bool m_hasCommittedOverflowMemory{true};
+    freeList_t m_freeOverflowIndices;
 };
 
 } // namespace mepoo
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_MEM_POOL_MAGAZINE_HPP
+#define IOX_POSH_MEPOO_MEM_POOL_MAGAZINE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief This class caches free chunks of a single MemPool for exactly one owner. The chunks are acquired from and
+///        returned to the shared free list of the MemPool in batches, therefore most of the 'getChunk' calls do not
+///        touch any memory which is shared with other threads or processes.
+///        The magazine is intended to be placed in shared memory next to the data of its owner, e.g. the
+///        ChunkSenderData. In case the owning application terminates unexpectedly, RouDi uses 'drain' to return the
+///        cached chunks to the MemPool.
+/// @note The cached chunks are accounted as used chunks by the MemPool
+/// @note The magazine is not thread-safe and has the same threading restrictions as its owner
+class MemPoolMagazine
+{
+  public:
+    static constexpr uint32_t CAPACITY{MEMPOOL_MAGAZINE_CAPACITY};
+
+    MemPoolMagazine() noexcept = default;
+    MemPoolMagazine(const MemPoolMagazine&) = delete;
+    MemPoolMagazine(MemPoolMagazine&&) = delete;
+    MemPoolMagazine& operator=(const MemPoolMagazine&) = delete;
+    MemPoolMagazine& operator=(MemPoolMagazine&&) = delete;
+    ~MemPoolMagazine() noexcept = default;
+
+    /// @brief Obtains a chunk from the magazine. If the magazine is empty it is refilled from the MemPool. If the
+    /// magazine holds chunks of another MemPool, it is drained before.
+    /// @param[in] memPool from which the chunk shall be obtained
+    /// @param[in] maxNumberOfChunksToAcquire limits the number of chunks which are acquired for a refill
+    /// @return a pointer to the chunk or a nullptr if the MemPool has no chunks left
+    void* getChunk(MemPool& memPool, const uint32_t maxNumberOfChunksToAcquire = CAPACITY) noexcept;
+
+    /// @brief Returns all cached chunks to the MemPool they were obtained from
+    /// @note from runtime context or from RouDi context once the owning application is terminated
+    void drain() noexcept;
+
+    /// @brief Returns the number of currently cached chunks
+    uint32_t size() const noexcept;
+
+  private:
+    RelativePointer<MemPool> m_memPool;
+    uint32_t m_numberOfChunks{0U};
+    uint32_t m_chunkIndices[CAPACITY];
+};
+
+/// @brief Combines the magazines which are required to obtain a SharedChunk from the MemoryManager, i.e. one for the
+///        chunk itself and one for its ChunkManagement. The number of cached ChunkManagement never exceeds the number
+///        of cached chunks. Since the chunk management pool has one element per chunk, this guarantees that every
+///        obtained chunk also gets a ChunkManagement, regardless of the number of magazines in the system.
+class ChunkMagazine
+{
+  public:
+    /// @brief Obtains a chunk from the magazine for the chunks
+    /// @param[in] memPool from which the chunk shall be obtained
+    /// @return a pointer to the chunk or a nullptr if the MemPool has no chunks left
+    void* getChunk(MemPool& memPool) noexcept;
+
+    /// @brief Obtains a ChunkManagement from the magazine for the ChunkManagements
+    /// @param[in] chunkManagementPool from which the ChunkManagement shall be obtained
+    /// @return a pointer to the memory for the ChunkManagement
+    /// @note must only be called after a successful call to 'getChunk'
+    void* getChunkManagement(MemPool& chunkManagementPool) noexcept;
+
+    /// @brief Returns all cached chunks to their MemPools
+    /// @note from runtime context or from RouDi context once the owning application is terminated
+    void drain() noexcept;
+
+  private:
+    MemPoolMagazine m_chunks;
+    MemPoolMagazine m_chunkManagements;
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEM_POOL_MAGAZINE_HPP
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
 #include "iox/algorithm.hpp"
@@ -72,27 +73,96 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools via the provided magazine which caches free chunks for its owner
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkMagazine which is used to obtain the chunk and its ChunkManagement
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkMagazine& chunkMagazine) noexcept;
+
+    /// @brief Obtains multiple chunks with the same chunk settings. As far as possible, the chunks and their
+    /// ChunkManagements are popped from the free lists of the mempools in one operation.
+    /// @param[in] chunkSettings for the requested chunks
+    /// @param[out] chunks is an array with at least 'numberOfChunks' elements which is filled with the obtained chunks
+    /// @param[in] numberOfChunks is the number of requested chunks
+    /// @return void if all chunks could be obtained, otherwise a MemoryManager::Error and none of the chunks is
+    /// obtained
+    expected<void, Error>
+    getChunks(const ChunkSettings& chunkSettings, SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Releases the physical memory of the overflow chunks of all mempools which are idle
+    /// @note must only be called from one thread, e.g. the RouDi monitoring loop
+    void releaseIdleOverflowMemory() noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
   private:
+    /// @brief the layout of the buddy mempool which is derived from the entries of the MePooConfig
+    struct BuddyMemPoolLayout
+    {
+        uint64_t minChunkSize{0U};
+        uint32_t numberOfMinChunks{0U};
+        uint32_t maxOrder{0U};
+    };
+
     static uint64_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    /// @brief the space which is reserved at the start of each chunk for the embedded ChunkManagement; 0 if the
+    /// ChunkManagements are obtained from the chunk management pool
+    static uint64_t embeddedChunkManagementSize(const MePooConfig& mePooConfig) noexcept;
+    static BuddyMemPoolLayout buddyMemPoolLayout(const MePooConfig& mePooConfig) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                    const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
+                    const greater_or_equal<uint32_t, 1> numberOfChunks,
+                    const optional<uint32_t> numaNode,
+                    const uint32_t numberOfOverflowChunks) noexcept;
+    void addBuddyMemPool(BumpAllocator& managementAllocator,
+                         BumpAllocator& chunkMemoryAllocator,
+                         const MePooConfig& mePooConfig) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassIndex() noexcept;
+    uint32_t findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept;
+    uint32_t findNumaLocalMemPoolIndex(const uint32_t memPoolIndex) const noexcept;
+    void* getChunkFromMemPool(MemPool& memPool, ChunkMagazine* const chunkMagazine) noexcept;
+    SharedChunk constructChunk(void* const chunk,
+                               MemPool& memPool,
+                               const uint64_t chunkSize,
+                               const ChunkSettings& chunkSettings,
+                               void* const chunkManagementMemory) noexcept;
+    uint32_t getChunksFromMemPool(MemPool& memPool,
+                                  const ChunkSettings& chunkSettings,
+                                  SharedChunk* const chunks,
+                                  const uint32_t numberOfChunks) noexcept;
+    expected<SharedChunk, Error> getChunkImpl(const ChunkSettings& chunkSettings,
+                                              ChunkMagazine* const chunkMagazine) noexcept;
 
   private:
+    /// @brief one size class for each power of two of the chunk size
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{64U};
+    /// @brief the number of chunks which are popped from the free lists in one operation by 'getChunks'
+    static constexpr uint32_t CHUNK_BULK_SIZE{MemPoolMagazine::CAPACITY};
+
     bool m_denyAddMemPool{false};
+    bool m_fallbackToLargerMemPool{false};
+    /// @brief true if there are mempools with the same chunk size which are bound to different NUMA nodes
+    bool m_hasNumaLocalMemPools{false};
+    /// @brief true if the chunks are obtained from a single buddy mempool
+    bool m_hasBuddyMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    /// @brief the space which is reserved at the start of each chunk for the ChunkManagement; 0 if the
+    /// ChunkManagements are obtained from the chunk management pool
+    uint64_t m_embeddedChunkManagementSize{0U};
+
+    /// @brief index of the first mempool whose chunk size is at least 2^k for size class k; the number of mempools
+    /// if there is no such mempool
+    uint32_t m_sizeClassToMemPoolIndex[NUMBER_OF_SIZE_CLASSES]{};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/huge_page_config.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
@@ -41,7 +42,9 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const HugePageConfig& hugePageConfig = HugePageConfig(),
+                 const optional<uint32_t> numaNode = nullopt) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -52,16 +55,38 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief Returns the start address of the segment memory in the address space of the current process
+    void* getBaseAddress() noexcept;
+
+    /// @brief Returns the size of the pages which back the segment
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief Returns the mount point of the hugetlbfs which contains the segment or nullopt if the segment is not
+    /// backed by huge pages
+    const optional<Path>& getHugePageMountPoint() const noexcept;
+
+    /// @brief Returns the NUMA node the segment memory is bound to or nullopt if the segment is not bound to a NUMA
+    /// node; single mempools might be bound to other NUMA nodes
+    optional<uint32_t> getNumaNode() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const DomainId domainId,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const HugePageConfig& hugePageConfig) noexcept;
+    void registerSharedMemoryObject(SharedMemoryObjectType& sharedMemoryObject) noexcept;
+    bool applyAccessRights(SharedMemoryObjectType& sharedMemoryObject) const noexcept;
+    static MePooConfig mempoolConfigWithNumaNode(const MePooConfig& mempoolConfig,
+                                                 const optional<uint32_t> numaNode) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
     PosixGroup m_writerGroup;
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
+    uint64_t m_pageSize{0};
+    optional<Path> m_hugePageMountPoint;
+    optional<uint32_t> m_numaNode;
     iox::mepoo::MemoryInfo m_memoryInfo;
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
@@ -25,7 +25,10 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/convert.hpp"
+#include "iox/detail/posix_numa.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 #include "iox/relative_pointer.hpp"
 
 namespace iox
@@ -42,77 +45,155 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const HugePageConfig& hugePageConfig,
+    const optional<uint32_t> numaNode) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
+    , m_numaNode(numaNode)
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup))
+    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, domainId, writerGroup, hugePageConfig))
+{
+    if (!applyAccessRights(m_sharedMemoryObject))
+    {
+        IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
+    }
+
+    const auto segmentSize = m_sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+    if (m_numaNode.has_value())
+    {
+        // the pages are not yet touched, therefore they will be allocated on the NUMA node; in case of a failure the
+        // segment is still usable but the memory might be remote to the NUMA node
+        detail::bindMemoryToNumaNode(m_sharedMemoryObject.getBaseAddress(), segmentSize, m_numaNode.value());
+    }
+
+    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(), segmentSize);
+    m_memoryManager.configureMemoryManager(
+        mempoolConfigWithNumaNode(mempoolConfig, m_numaNode), managementAllocator, allocator);
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline MePooConfig MePooSegment<SharedMemoryObjectType, MemoryManagerType>::mempoolConfigWithNumaNode(
+    const MePooConfig& mempoolConfig, const optional<uint32_t> numaNode) noexcept
+{
+    // mempools without an explicit NUMA node inherit the one of the segment
+    MePooConfig config = mempoolConfig;
+    for (auto& entry : config.m_mempoolConfig)
+    {
+        if (!entry.m_numaNode.has_value())
+        {
+            entry.m_numaNode = numaNode;
+        }
+    }
+    return config;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::applyAccessRights(
+    SharedMemoryObjectType& sharedMemoryObject) const noexcept
 {
     using namespace detail;
     PosixAcl acl;
-    if (!(readerGroup == writerGroup))
+    if (!(m_readerGroup == m_writerGroup))
     {
-        acl.addGroupPermission(PosixAcl::Permission::READ, readerGroup.getName());
+        acl.addGroupPermission(PosixAcl::Permission::READ, m_readerGroup.getName());
     }
-    acl.addGroupPermission(PosixAcl::Permission::READWRITE, writerGroup.getName());
+    acl.addGroupPermission(PosixAcl::Permission::READWRITE, m_writerGroup.getName());
     acl.addPermissionEntry(PosixAcl::Category::USER, PosixAcl::Permission::READWRITE);
     acl.addPermissionEntry(PosixAcl::Category::GROUP, PosixAcl::Permission::READWRITE);
     acl.addPermissionEntry(PosixAcl::Category::OTHERS, PosixAcl::Permission::NONE);
 
-    if (!acl.writePermissionsToFile(m_sharedMemoryObject.getFileHandle()))
-    {
-        IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
-    }
-
-    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
-                            m_sharedMemoryObject.get_size().expect("Failed to get SHM size."));
-    m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
+    return acl.writePermissionsToFile(sharedMemoryObject.getFileHandle());
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const DomainId domainId, const PosixGroup& writerGroup) noexcept
-{
-    return std::move(
-        typename SharedMemoryObjectType::Builder()
-            .name([&domainId, &writerGroup] {
-                using ShmName_t = detail::PosixSharedMemory::Name_t;
-                ShmName_t shmName = iceoryxResourcePrefix(domainId, ResourceType::USER_DEFINED);
-                if (shmName.size() + writerGroup.getName().size() > ShmName_t::capacity())
-                {
-                    IOX_LOG(Fatal,
-                            "The payload segment with the name '"
-                                << writerGroup.getName().size()
-                                << "' would exceed the maximum allowed size when used with the '" << shmName
-                                << "' prefix!");
-                    IOX_PANIC("");
-                }
-                shmName.append(TruncateToCapacity, writerGroup.getName());
-                return shmName;
-            }())
-            .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
+    const MePooConfig& mempoolConfig,
+    const DomainId domainId,
+    const PosixGroup& writerGroup,
+    const HugePageConfig& hugePageConfig) noexcept
+{
+    using ShmName_t = detail::PosixSharedMemory::Name_t;
+    ShmName_t shmName = iceoryxResourcePrefix(domainId, ResourceType::USER_DEFINED);
+    if (shmName.size() + writerGroup.getName().size() > ShmName_t::capacity())
+    {
+        IOX_LOG(Fatal,
+                "The payload segment with the name '" << writerGroup.getName().size()
+                                                      << "' would exceed the maximum allowed size when used with the '"
+                                                      << shmName << "' prefix!");
+        IOX_PANIC("");
+    }
+    shmName.append(TruncateToCapacity, writerGroup.getName());
+
+    const auto requiredMemorySize = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    auto createSharedMemory = [&](const uint64_t memorySize, const optional<Path>& mountPoint) {
+        return typename SharedMemoryObjectType::Builder()
+            .name(shmName)
+            .memorySizeInBytes(memorySize)
             .accessMode(AccessMode::ReadWrite)
             .openMode(OpenMode::PurgeAndCreate)
             .permissions(SEGMENT_PERMISSIONS)
-            .create()
-            .and_then([this](auto& sharedMemoryObject) {
-                auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
-                    sharedMemoryObject.getBaseAddress(),
-                    sharedMemoryObject.get_size().expect("Failed to get SHM size"));
-                if (!maybeSegmentId.has_value())
-                {
-                    IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS);
-                }
-                this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
-                this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
-
-                IOX_LOG(Debug,
-                        "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
-                                                                 << " with size " << m_segmentSize << " to id "
-                                                                 << m_segmentId);
-            })
-            .or_else([](auto&) { IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
-            .value());
+            .mountPoint(mountPoint)
+            .create();
+    };
+
+    if (hugePageConfig.isEnabled())
+    {
+        if (!hugePageConfig.m_mountPoint)
+        {
+            IOX_LOG(Warn,
+                    "Huge pages are requested for the payload segment '"
+                        << shmName << "' but no hugetlbfs mount point is provided! Falling back to regular pages.");
+        }
+        else
+        {
+            // the size of a file in a hugetlbfs must be a multiple of the huge page size
+            auto sharedMemoryObject = createSharedMemory(align(requiredMemorySize, hugePageConfig.m_pageSize),
+                                                         hugePageConfig.m_mountPoint);
+            if (!sharedMemoryObject.has_error() && applyAccessRights(sharedMemoryObject.value()))
+            {
+                m_pageSize = hugePageConfig.m_pageSize;
+                m_hugePageMountPoint = hugePageConfig.m_mountPoint;
+                registerSharedMemoryObject(sharedMemoryObject.value());
+                return std::move(sharedMemoryObject.value());
+            }
+
+            IOX_LOG(Warn,
+                    "Unable to back the payload segment '"
+                        << shmName << "' with huge pages of " << hugePageConfig.m_pageSize << " bytes from '"
+                        << hugePageConfig.m_mountPoint->as_string()
+                        << "'! Probably not enough huge pages are reserved. Falling back to regular pages.");
+        }
+    }
+
+    m_pageSize = detail::pageSize();
+    return std::move(createSharedMemory(requiredMemorySize, nullopt)
+                         .and_then([this](auto& sharedMemoryObject) {
+                             this->registerSharedMemoryObject(sharedMemoryObject);
+                         })
+                         .or_else([](auto&) {
+                             IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT);
+                         })
+                         .value());
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::registerSharedMemoryObject(
+    SharedMemoryObjectType& sharedMemoryObject) noexcept
+{
+    auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
+        sharedMemoryObject.getBaseAddress(), sharedMemoryObject.get_size().expect("Failed to get SHM size"));
+    if (!maybeSegmentId.has_value())
+    {
+        IOX_REPORT_FATAL(PoshError::MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS);
+    }
+    m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
+    m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+
+    IOX_LOG(Debug,
+            "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
+                                                     << " with size " << m_segmentSize << " and page size "
+                                                     << m_pageSize << " to id " << m_segmentId);
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -145,6 +226,31 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentSize;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const optional<Path>&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getHugePageMountPoint() const noexcept
+{
+    return m_hugePageMountPoint;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline void* MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getBaseAddress() noexcept
+{
+    return m_sharedMemoryObject.getBaseAddress();
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline optional<uint32_t> MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getNumaNode() const noexcept
+{
+    return m_numaNode;
+}
+
 } // namespace mepoo
 } // namespace iox
 
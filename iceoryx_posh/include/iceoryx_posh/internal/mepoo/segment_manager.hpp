@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/string.hpp"
@@ -75,6 +76,7 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        optional<Path> m_hugePageMountPoint; // set if the segment is backed by huge pages
     };
 
     struct SegmentUserInformation
@@ -88,6 +90,13 @@ class SegmentManager
     SegmentMappingContainer getSegmentMappings(const PosixUser& user) noexcept;
     SegmentUserInformation getSegmentInformationWithWriteAccessForUser(const PosixUser& user) noexcept;
 
+    /// @brief Calls the provided callable with the start address and the size of the memory of each segment
+    /// @param[in] callable which is called for each segment
+    void forEachSegmentMemory(const function_ref<void(void*, uint64_t)> callable) noexcept;
+
+    /// @brief Releases the physical memory of the idle overflow chunks of the mempools of all segments
+    void releaseIdleOverflowMemory() noexcept;
+
     static uint64_t requiredManagementMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredChunkMemorySize(const SegmentConfig& config) noexcept;
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
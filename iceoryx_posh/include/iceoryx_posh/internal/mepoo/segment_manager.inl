@@ -58,7 +58,9 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
                                     *m_managementAllocator,
                                     readerGroup,
                                     writerGroup,
-                                    segmentEntry.m_memoryInfo);
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_hugePageConfig,
+                                    segmentEntry.m_numaNode);
 }
 
 template <typename SegmentType>
@@ -84,6 +86,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                 {
                     mappingContainer.emplace_back(
                         segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                    mappingContainer.back().m_hugePageMountPoint = segment.getHugePageMountPoint();
                     foundInWriterGroup = true;
                 }
                 else
@@ -107,6 +110,7 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
             {
                 mappingContainer.emplace_back(
                     segment.getWriterGroup().getName(), segment.getSegmentSize(), false, segment.getSegmentId());
+                mappingContainer.back().m_hugePageMountPoint = segment.getHugePageMountPoint();
             }
         }
     }
@@ -139,6 +143,25 @@ SegmentManager<SegmentType>::getSegmentInformationWithWriteAccessForUser(const P
     return segmentInfo;
 }
 
+template <typename SegmentType>
+inline void
+SegmentManager<SegmentType>::forEachSegmentMemory(const function_ref<void(void*, uint64_t)> callable) noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        callable(segment.getBaseAddress(), segment.getSegmentSize());
+    }
+}
+
+template <typename SegmentType>
+inline void SegmentManager<SegmentType>::releaseIdleOverflowMemory() noexcept
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        segment.getMemoryManager().releaseIdleOverflowMemory();
+    }
+}
+
 template <typename SegmentType>
 uint64_t SegmentManager<SegmentType>::requiredManagementMemorySize(const SegmentConfig& config) noexcept
 {
@@ -41,6 +41,12 @@ class ShmSafeUnmanagedChunk
     /// @brief Creates a SharedChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedChunk cloneToSharedChunk() noexcept;
 
+    /// @brief Creates a SharedChunk with incrementing the chunk reference counter if the chunk is still alive, i.e. the
+    /// reference counter is not zero, and does not invalidate itself. This is used to clone a chunk which might be
+    /// released concurrently by another owner.
+    /// @return the SharedChunk or an empty SharedChunk if the chunk was already released
+    SharedChunk tryCloneToSharedChunk() noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
     /// @return true if logically a nullptr otherwise false
     bool isLogicalNullptr() const noexcept;
@@ -99,6 +99,14 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscriber<po
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline expected<uint32_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                   const uint32_t maxNumberOfChunks) noexcept
+{
+    return m_port.tryGetChunks(chunkHeaders, maxNumberOfChunks);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
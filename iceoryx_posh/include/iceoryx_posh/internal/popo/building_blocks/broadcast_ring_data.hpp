@@ -0,0 +1,72 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_DATA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iox/atomic.hpp"
+#include "iox/detail/unique_id.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Ring with the latest chunks of a single sender which is shared by all attached receivers. Each slot is tagged
+/// with the sequence number of the chunk it holds; a receiver which was overtaken by the sender detects this by a
+/// mismatch of the sequence number and skips the overwritten chunks.
+struct BroadcastRingData
+{
+    explicit BroadcastRingData(const uint64_t capacity) noexcept;
+
+    static constexpr uint64_t INVALID_SEQUENCE_NUMBER{std::numeric_limits<uint64_t>::max()};
+
+    struct Slot
+    {
+        concurrent::Atomic<uint64_t> m_sequenceNumber{INVALID_SEQUENCE_NUMBER};
+        concurrent::Atomic<mepoo::ShmSafeUnmanagedChunk> m_chunk;
+    };
+
+    const UniqueId m_uniqueId{};
+    const uint64_t m_capacity;
+    /// all chunks with a smaller sequence number are published
+    concurrent::Atomic<uint64_t> m_nextSequenceNumber{0U};
+    Slot m_slots[MAX_BROADCAST_RING_CAPACITY];
+};
+
+/// @brief The read cursor of a receiver queue into the BroadcastRingData of a sender
+struct BroadcastRingCursorData
+{
+    static constexpr uint64_t NO_BROADCAST_RING{0U};
+
+    /// RouDi sets the ring and the cursor before it publishes the id of the ring in 'm_attachedBroadcastRingId'; when
+    /// the ring is detached, the id is reset first and RouDi waits until the receiver left the ring with 'm_isInUse'
+    RelativePointer<BroadcastRingData> m_broadcastRing;
+    uint64_t m_nextSequenceNumber{0U};
+    concurrent::Atomic<uint64_t> m_attachedBroadcastRingId{NO_BROADCAST_RING};
+    mutable concurrent::Atomic<bool> m_isInUse{false};
+    concurrent::Atomic<bool> m_hasLostChunks{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_DATA_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_READER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_READER_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
+#include "iox/not_null.hpp"
+#include "iox/optional.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The BroadcastRingReader reads the chunks of a BroadcastRingData with the cursor of one receiver. When the
+/// writer overtook the cursor, the overwritten chunks are skipped and reported as lost chunks. Every method returns
+/// immediately without a chunk if the cursor is not attached to a ring.
+class BroadcastRingReader
+{
+  public:
+    using MemberType_t = BroadcastRingCursorData;
+
+    explicit BroadcastRingReader(not_null<MemberType_t* const> cursorDataPtr) noexcept;
+
+    BroadcastRingReader(const BroadcastRingReader& other) = delete;
+    BroadcastRingReader& operator=(const BroadcastRingReader&) = delete;
+    BroadcastRingReader(BroadcastRingReader&& rhs) noexcept = default;
+    BroadcastRingReader& operator=(BroadcastRingReader&& rhs) noexcept = default;
+    ~BroadcastRingReader() noexcept = default;
+
+    /// @brief read the next chunk of the ring
+    /// @return optional for a shared chunk that is set if the cursor did not reach the latest chunk
+    optional<mepoo::SharedChunk> tryPop() noexcept;
+
+    /// @brief check if chunks were overwritten before they were read and reset flag
+    /// @return true if chunks were lost since the last call of this method
+    bool hasLostChunks() noexcept;
+
+    /// @brief check if there are unread chunks
+    /// @return true if the cursor reached the latest chunk or is not attached, otherwise false
+    bool empty() const noexcept;
+
+    /// @brief get the number of unread chunks which are still in the ring. Caution, the writer can have published
+    /// further chunks just after reading it
+    /// @return number of unread chunks
+    uint64_t size() const noexcept;
+
+    /// @brief skip all unread chunks
+    void clear() noexcept;
+
+  protected:
+    const MemberType_t* getMembers() const noexcept;
+    MemberType_t* getMembers() noexcept;
+
+  private:
+    /// @brief announces the use of the ring to RouDi
+    /// @return the attached ring or nullptr if the cursor is not attached
+    BroadcastRingData* enterBroadcastRing() const noexcept;
+    void leaveBroadcastRing() const noexcept;
+
+    MemberType_t* m_cursorDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_READER_HPP
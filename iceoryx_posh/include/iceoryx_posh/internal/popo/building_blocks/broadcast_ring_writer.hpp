@@ -0,0 +1,87 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_WRITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_WRITER_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
+#include "iox/duration.hpp"
+#include "iox/not_null.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The BroadcastRingWriter publishes chunks into a BroadcastRingData. The cost of a publish does not depend on
+/// the number of receivers since every receiver reads the ring with its own cursor. There must be only one writer at a
+/// time. RouDi uses the writer to attach and detach the cursors of the receivers.
+class BroadcastRingWriter
+{
+  public:
+    using MemberType_t = BroadcastRingData;
+
+    explicit BroadcastRingWriter(not_null<MemberType_t* const> broadcastRingDataPtr) noexcept;
+
+    BroadcastRingWriter(const BroadcastRingWriter& other) = delete;
+    BroadcastRingWriter& operator=(const BroadcastRingWriter&) = delete;
+    BroadcastRingWriter(BroadcastRingWriter&& rhs) noexcept = default;
+    BroadcastRingWriter& operator=(BroadcastRingWriter&& rhs) noexcept = default;
+    ~BroadcastRingWriter() noexcept = default;
+
+    /// @brief writes a chunk into the ring and releases the oldest chunk if the ring is full
+    /// @param[in] chunk to publish
+    void push(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief releases all chunks of the ring; the sequence numbers are continued by the next push
+    void releaseAll() noexcept;
+
+    /// @brief attaches the cursor of a receiver to the ring
+    /// @param[in] cursor of the receiver
+    /// @param[in] numberOfHistoryChunks is the number of already published chunks the receiver starts with
+    /// @return true if the cursor was attached, false if it is already attached to a ring or the ring cannot provide
+    /// the requested history
+    bool attach(BroadcastRingCursorData& cursor, const uint64_t numberOfHistoryChunks) noexcept;
+
+    /// @brief detaches the cursor of a receiver if it is attached to this ring; waits until the receiver left the ring
+    /// @param[in] cursor of the receiver
+    void detach(BroadcastRingCursorData& cursor) noexcept;
+
+    /// @brief checks whether the cursor of a receiver is attached to this ring
+    /// @param[in] cursor of the receiver
+    /// @return true if attached, otherwise false
+    bool isAttached(const BroadcastRingCursorData& cursor) const noexcept;
+
+    /// @brief get the number of chunks the ring can hold
+    /// @return capacity of the ring
+    uint64_t getCapacity() const noexcept;
+
+  protected:
+    const MemberType_t* getMembers() const noexcept;
+    MemberType_t* getMembers() noexcept;
+
+  private:
+    /// @brief the time RouDi waits for a receiver to leave the ring before a detached cursor is assumed to belong to a
+    /// terminated receiver
+    static constexpr units::Duration READER_GRACE_PERIOD{units::Duration::fromSeconds(1U)};
+
+    MemberType_t* m_broadcastRingDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_WRITER_HPP
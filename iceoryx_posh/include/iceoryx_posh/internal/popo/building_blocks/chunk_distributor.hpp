@@ -18,10 +18,12 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_writer.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/duration.hpp"
 #include "iox/not_null.hpp"
 
 #include <algorithm>
@@ -50,17 +52,14 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
-/// @todo iox-#1713 There are currently some challenges:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
-/// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
-/// terminated user application. Even if access from middleware and user threads do not overlap, the history
-/// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
-/// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
-/// A perfect job for our future selves
+/// The delivery to the stored queues does not use the lock. The queues are stored in a double buffered snapshot which
+/// is read by the sender while RouDi prepares the next snapshot under the lock. Before a modification of the queues
+/// returns, RouDi waits until the sender left the previous snapshot. Since this grace period is bounded, a sender which
+/// is terminated while delivering a chunk cannot block RouDi. It is assumed that there is only one sending thread.
+/// @todo iox-#1713 The lock is still used for the history. If a user process gets terminated while one of its
+/// threads adds a chunk to the history and holds the lock, the cleanup() call cannot release the chunks of the history
+/// anymore. We would need a container like the UsedChunkList to have one that is robust against such
+/// inconsistencies.... A perfect job for our future selves
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -78,7 +77,8 @@ class ChunkDistributor
     virtual ~ChunkDistributor() noexcept = default;
 
     /// @brief Add a queue to the internal list of chunk queues to which chunks are delivered when calling
-    /// deliverToAllStoredQueues
+    /// deliverToAllStoredQueues. If the distributor has a broadcast ring and the queue does not block the producer,
+    /// the queue is attached to the ring and reads the chunks and the history from there
     /// @param[in] queueToAdd chunk queue to add to the list
     /// @param[in] requestedHistory number of last chunks from history to send if available. If history size is smaller
     /// then the available history size chunks are provided
@@ -98,12 +98,25 @@ class ChunkDistributor
     /// @return true if there are stored chunk queues, false if not
     bool hasStoredQueues() const noexcept;
 
+    /// @brief Notify all the stored chunk queues without delivering a chunk, e.g. after the content of an already
+    /// delivered chunk was updated in place
+    /// @return the number of queues which were notified
+    uint64_t notifyAllStoredQueues() noexcept;
+
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. With a broadcast ring, the chunk is written once into the ring and the attached queues are only
+    /// notified
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in the order of the array to all the stored chunk queues. Each queue
+    /// is notified only once for all chunks. The chunks will be added to the chunk history
+    /// @param[in] chunks is an array with the SharedChunks to be delivered
+    /// @param[in] numberOfChunks is the number of chunks in the array
+    /// @return the number of deliveries, i.e. the sum of the number of queues each chunk was delivered to
+    uint64_t deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -120,8 +133,8 @@ class ChunkDistributor
     /// @return the index of the queue with uniqueQueueId or nullopt if the queue was not found
     optional<uint32_t> getQueueIndex(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex) const noexcept;
 
-    /// @brief Update the chunk history but do not deliver the chunk to any chunk queue. E.g. use case is to to update a
-    /// non offered field in ara
+    /// @brief Update the chunk history and the broadcast ring but do not deliver the chunk to any chunk queue. E.g. use
+    /// case is to to update a non offered field in ara
     /// @param[in] chunk to add to the chunk history
     void addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept;
 
@@ -136,7 +149,7 @@ class ChunkDistributor
     /// @brief Clears the chunk history
     void clearHistory() noexcept;
 
-    /// @brief cleanup the used shrared memory chunks
+    /// @brief cleanup the used shrared memory chunks, including the ones of the broadcast ring
     void cleanup() noexcept;
 
   protected:
@@ -146,6 +159,46 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    using QueueContainer_t = typename MemberType_t::QueueContainer_t;
+
+    /// @brief Announces the sender as reader of the active queue snapshot; must be followed by leaveQueueSnapshot
+    /// @return the queue snapshot which can be read until leaveQueueSnapshot is called
+    const QueueContainer_t& enterQueueSnapshot() const noexcept;
+    void leaveQueueSnapshot() const noexcept;
+
+    /// @brief Applies the modification to a copy of the active queue snapshot, publishes the copy and waits until the
+    /// sender left the previous snapshot; must be called with the lock held
+    template <typename Modification>
+    void updateQueueSnapshot(const Modification& modification) noexcept;
+
+    optional<uint32_t> findQueueIndex(const QueueContainer_t& queues,
+                                      const UniqueId uniqueQueueId,
+                                      const uint32_t lastKnownQueueIndex) const noexcept;
+
+    /// @brief Rebuilds the lookup of the queue index from the queues of the snapshot; must be called with the lock held
+    void rebuildQueueIndexLookup(const uint32_t snapshot) noexcept;
+    static uint32_t queueIndexLookupStartPosition(const UniqueId uniqueQueueId) noexcept;
+
+    void addToHistory(mepoo::SharedChunk chunk) noexcept;
+    mepoo::ShmSafeUnmanagedChunk& getHistoryChunk(const uint64_t index) noexcept;
+    void pushHistoryToQueue(not_null<ChunkQueueData_t* const> queue, const uint64_t requestedHistory) noexcept;
+
+    /// @brief Attaches the queue to the broadcast ring with the requested history; must be called with the lock held
+    /// @return true if the queue was attached, false if the chunks have to be pushed into the queue
+    bool tryAttachToBroadcastRing(not_null<ChunkQueueData_t* const> queue, const uint64_t requestedHistory) noexcept;
+    void detachFromBroadcastRing(not_null<ChunkQueueData_t* const> queue) noexcept;
+    bool isAttachedToBroadcastRing(const ChunkQueueData_t& queue) const noexcept;
+    void writeToBroadcastRing(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief The maximum time RouDi waits for the sender to leave a queue snapshot. Since a sender which waits for a
+    /// consumer is woken up when the snapshot is replaced, exceeding this time means the sender was terminated while
+    /// delivering a chunk.
+    static constexpr units::Duration QUEUE_SNAPSHOT_GRACE_PERIOD{units::Duration::fromSeconds(1U)};
+
+    /// @brief The maximum time a sender waits for a consumer of a full queue before it tries to deliver again. The
+    /// sender is woken up when a chunk is popped or the queues are modified, this is only a safety net.
+    static constexpr units::Duration MAX_WAIT_FOR_CONSUMER{units::Duration::fromMilliseconds(10U)};
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/deadline_timer.hpp"
 
 namespace iox
 {
@@ -53,22 +54,19 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    // only RouDi modifies the queues and this is done with the lock held; therefore the active snapshot can be read
+    const auto& queues =
+        getMembers()->m_queueSnapshots[getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed)];
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+        std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t> queue) {
+            return queue.get() == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == queues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() < queues.capacity())
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
-
-            const auto currChunkHistorySize = getMembers()->m_history.size();
-
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
                 IOX_LOG(Warn,
@@ -76,15 +74,19 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                             << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
             }
 
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
+            // the history is delivered before the queue is published in order to deliver it before any chunk of the
+            // sender
+            if (!tryAttachToBroadcastRing(queueToAdd, requestedHistory))
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                pushHistoryToQueue(queueToAdd, requestedHistory);
             }
 
+            updateQueueSnapshot([&](QueueContainer_t& nextQueues) {
+                // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
+                // pushing will be fine
+                nextQueues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            });
+
             return ok();
         }
         else
@@ -106,13 +108,18 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(),
-                                getMembers()->m_queues.end(),
-                                static_cast<ChunkQueueData_t* const>(queueToRemove));
-    if (iter != getMembers()->m_queues.end())
+    const auto& queues =
+        getMembers()->m_queueSnapshots[getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed)];
+    const auto iter = std::find(queues.begin(), queues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove));
+    if (iter != queues.end())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        const auto index = static_cast<uint64_t>(std::distance(queues.begin(), iter));
+        updateQueueSnapshot([&](QueueContainer_t& nextQueues) {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be
+            // ignored
+            nextQueues.erase(nextQueues.begin() + index);
+        });
+        detachFromBroadcastRing(queueToRemove);
 
         return ok();
     }
@@ -127,30 +134,62 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    const auto previousSnapshot = getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed);
+    updateQueueSnapshot([](QueueContainer_t& nextQueues) { nextQueues.clear(); });
+
+    // the previous snapshot is only modified by the next update which requires the lock
+    for (auto& queue : getMembers()->m_queueSnapshots[previousSnapshot])
+    {
+        detachFromBroadcastRing(queue.get());
+    }
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto& queues = enterQueueSnapshot();
+    const bool hasQueues = !queues.empty();
+    leaveQueueSnapshot();
+
+    return hasQueues;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::notifyAllStoredQueues() noexcept
+{
+    const auto& queues = enterQueueSnapshot();
+    const auto numberOfQueues = queues.size();
+    for (auto& queue : queues)
+    {
+        ChunkQueuePusher_t(queue.get()).notify();
+    }
+    leaveQueueSnapshot();
 
-    return !getMembers()->m_queues.empty();
+    return numberOfQueues;
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    // the chunk is in the ring before the attached queues are notified
+    writeToBroadcastRing(chunk);
+
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
-    QueueContainer fullQueuesAwaitingDelivery;
+    QueueContainer_t fullQueuesAwaitingDelivery;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto& queues = enterQueueSnapshot();
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
         // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        for (auto& queue : queues)
         {
+            if (isAttachedToBroadcastRing(*queue))
+            {
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+                ChunkQueuePusher_t(queue.get()).notify();
+                continue;
+            }
+
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
             if (pushToQueue(queue.get(), chunk))
@@ -170,60 +209,154 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
                 }
             }
         }
+
+        leaveQueueSnapshot();
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // wait until every queue is served
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
+        const auto& queues = enterQueueSnapshot();
+
+        QueueContainer_t remainingQueues;
+        for (auto& queue : fullQueuesAwaitingDelivery)
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](const QueueContainerValue& a, const QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
-
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+            // it is possible that since the last iteration some subscriber have already unsubscribed and without
+            // this check we would deliver to dead queues
+            auto isQueueStillStored = std::any_of(queues.begin(), queues.end(), [&](const auto& storedQueue) {
+                return storedQueue.get() == queue.get();
+            });
+            if (!isQueueStillStored)
             {
-                if (pushToQueue(queue.get(), chunk))
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
-                else
+                continue;
+            }
+
+            if (pushToQueue(queue.get(), chunk))
+            {
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+            else
+            {
+                remainingQueues.push_back(queue);
+            }
+        }
+
+        // the queue is only valid as long as the snapshot is used, therefore the sender waits within the snapshot
+        if (!remainingQueues.empty())
+        {
+            ChunkQueuePusher_t(remainingQueues.front().get()).waitUntilNotFull(MAX_WAIT_FOR_CONSUMER);
+        }
+
+        leaveQueueSnapshot();
+        fullQueuesAwaitingDelivery = std::move(remainingQueues);
+    }
+
+    addToHistory(chunk);
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                                                     const uint32_t numberOfChunks) noexcept
+{
+    struct PendingDelivery
+    {
+        ChunkQueueData_t* queue;
+        uint32_t nextChunkIndex;
+    };
+    using PendingDeliveryContainer = vector<PendingDelivery, QueueContainer_t::capacity()>;
+
+    // pushes the chunks starting at 'nextChunkIndex' and notifies the queue once; returns false if a blocking queue is
+    // full and the remaining chunks have to be delivered later
+    uint64_t numberOfDeliveries{0U};
+    auto pushChunks = [&](PendingDelivery& delivery, const bool isBlockingQueue) -> bool {
+        ChunkQueuePusher_t pusher(delivery.queue);
+        bool isDelivered{true};
+        for (; delivery.nextChunkIndex < numberOfChunks; ++delivery.nextChunkIndex)
+        {
+            if (!pusher.pushWithoutNotification(chunks[delivery.nextChunkIndex]))
+            {
+                if (isBlockingQueue)
                 {
-                    fullQueuesAwaitingDelivery.push_back(queue);
+                    isDelivered = false;
+                    break;
                 }
+                pusher.lostAChunk();
             }
+            ++numberOfDeliveries;
         }
+        pusher.notify();
+        return isDelivered;
+    };
+
+    // the chunks are in the ring before the attached queues are notified
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        writeToBroadcastRing(chunks[i]);
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    PendingDeliveryContainer fullQueuesAwaitingDelivery;
+    {
+        const auto& queues = enterQueueSnapshot();
 
-    return numberOfQueuesTheChunkWasDeliveredTo;
+        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        for (auto& queue : queues)
+        {
+            if (isAttachedToBroadcastRing(*queue))
+            {
+                numberOfDeliveries += numberOfChunks;
+                ChunkQueuePusher_t(queue.get()).notify();
+                continue;
+            }
+
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            PendingDelivery delivery{queue.get(), 0U};
+            if (!pushChunks(delivery, isBlockingQueue))
+            {
+                fullQueuesAwaitingDelivery.emplace_back(delivery);
+            }
+        }
+
+        leaveQueueSnapshot();
+    }
+
+    // wait until every queue is served
+    while (!fullQueuesAwaitingDelivery.empty())
+    {
+        const auto& queues = enterQueueSnapshot();
+
+        PendingDeliveryContainer remainingDeliveries;
+        for (auto& delivery : fullQueuesAwaitingDelivery)
+        {
+            // it is possible that since the last iteration some subscriber have already unsubscribed and without
+            // this check we would deliver to dead queues
+            auto isQueueStillStored = std::any_of(
+                queues.begin(), queues.end(), [&](const auto& queue) { return queue.get() == delivery.queue; });
+            if (isQueueStillStored && !pushChunks(delivery, true))
+            {
+                remainingDeliveries.emplace_back(delivery);
+            }
+        }
+
+        // the queue is only valid as long as the snapshot is used, therefore the sender waits within the snapshot
+        if (!remainingDeliveries.empty())
+        {
+            ChunkQueuePusher_t(remainingDeliveries.front().queue).waitUntilNotFull(MAX_WAIT_FOR_CONSUMER);
+        }
+
+        leaveQueueSnapshot();
+        fullQueuesAwaitingDelivery = std::move(remainingDeliveries);
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        addToHistory(chunks[i]);
+    }
+
+    return numberOfDeliveries;
 }
 
 template <typename ChunkDistributorDataType>
@@ -242,16 +375,17 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
     bool retry{false};
     do
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto& queues = enterQueueSnapshot();
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
+            leaveQueueSnapshot();
             return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        auto& queue = queues[queueIndex.value()];
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
 
@@ -263,12 +397,15 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
             if (isBlockingQueue)
             {
                 retry = true;
+                ChunkQueuePusher_t(queue.get()).waitUntilNotFull(MAX_WAIT_FOR_CONSUMER);
             }
             else
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
             }
         }
+
+        leaveQueueSnapshot();
     } while (retry);
 
     return ok();
@@ -279,53 +416,140 @@ inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    const auto& queues = enterQueueSnapshot();
+    auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
+    leaveQueueSnapshot();
 
-    auto& queues = getMembers()->m_queues;
+    return queueIndex;
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) const noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
     }
 
-    uint32_t index{0};
-    for (auto& queue : queues)
+    // the lookup belongs to the snapshot the queues are read from
+    const auto snapshot = static_cast<uint32_t>(&queues - &getMembers()->m_queueSnapshots[0]);
+    const auto& queueIndexLookup = getMembers()->m_queueIndexLookups[snapshot];
+    for (auto lookupPosition = queueIndexLookupStartPosition(uniqueQueueId);
+         queueIndexLookup[lookupPosition] != MemberType_t::NO_QUEUE_INDEX;
+         lookupPosition = (lookupPosition + 1U) & (MemberType_t::QUEUE_INDEX_LOOKUP_CAPACITY - 1U))
     {
-        if (queue->m_uniqueId == uniqueQueueId)
+        const uint32_t index = queueIndexLookup[lookupPosition];
+        if (queues[index]->m_uniqueId == uniqueQueueId)
         {
             return index;
         }
-        ++index;
     }
     return nullopt;
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::rebuildQueueIndexLookup(const uint32_t snapshot) noexcept
+{
+    auto& queueIndexLookup = getMembers()->m_queueIndexLookups[snapshot];
+    for (auto& queueIndex : queueIndexLookup)
+    {
+        queueIndex = MemberType_t::NO_QUEUE_INDEX;
+    }
+
+    const auto& queues = getMembers()->m_queueSnapshots[snapshot];
+    for (uint32_t index = 0U; index < queues.size(); ++index)
+    {
+        auto lookupPosition = queueIndexLookupStartPosition(queues[index]->m_uniqueId);
+        while (queueIndexLookup[lookupPosition] != MemberType_t::NO_QUEUE_INDEX)
+        {
+            lookupPosition = (lookupPosition + 1U) & (MemberType_t::QUEUE_INDEX_LOOKUP_CAPACITY - 1U);
+        }
+        queueIndexLookup[lookupPosition] = static_cast<typename MemberType_t::QueueIndex_t>(index);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t
+ChunkDistributor<ChunkDistributorDataType>::queueIndexLookupStartPosition(const UniqueId uniqueQueueId) noexcept
+{
+    // Fibonacci hashing of the unique id
+    constexpr uint64_t FIBONACCI_HASH_MULTIPLIER{0x9E3779B97F4A7C15ULL};
+    const auto key = static_cast<UniqueId::value_type>(uniqueQueueId);
+    return static_cast<uint32_t>((key * FIBONACCI_HASH_MULTIPLIER) >> 32U)
+           & (MemberType_t::QUEUE_INDEX_LOOKUP_CAPACITY - 1U);
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // the ring contains the latest chunks of the history in order to provide the history to the attached queues
+    writeToBroadcastRing(chunk);
+    addToHistory(chunk);
+}
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistory(mepoo::SharedChunk chunk) noexcept
+{
+    // the history capacity is constant, therefore the lock is only taken if there is a history
     if (0u < getMembers()->m_historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        auto* const members = getMembers();
+
+        if (members->m_historySize >= members->m_historyCapacity)
+        {
+            // the oldest chunk is replaced by the new one, which becomes the newest chunk by moving the start
+            auto& oldestChunk = members->m_history[members->m_historyStart];
+            oldestChunk.releaseToSharedChunk();
+            oldestChunk = mepoo::ShmSafeUnmanagedChunk(chunk);
+            members->m_historyStart = (members->m_historyStart + 1U) % members->m_historyCapacity;
+        }
+        else
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            members->m_history[(members->m_historyStart + members->m_historySize) % members->m_historyCapacity] =
+                mepoo::ShmSafeUnmanagedChunk(chunk);
+            ++members->m_historySize;
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline mepoo::ShmSafeUnmanagedChunk&
+ChunkDistributor<ChunkDistributorDataType>::getHistoryChunk(const uint64_t index) noexcept
+{
+    return getMembers()->m_history[(getMembers()->m_historyStart + index) % getMembers()->m_historyCapacity];
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::pushHistoryToQueue(not_null<ChunkQueueData_t* const> queue,
+                                                               const uint64_t requestedHistory) noexcept
+{
+    // if the current history is large enough we send the requested number of chunks, else we send the total history
+    const auto historySize = getMembers()->m_historySize;
+    const auto numberOfHistoryChunks = algorithm::minVal(requestedHistory, historySize);
+    if (numberOfHistoryChunks == 0U)
+    {
+        return;
+    }
+
+    ChunkQueuePusher_t queuePusher(queue);
+    for (auto i = historySize - numberOfHistoryChunks; i < historySize; ++i)
+    {
+        queuePusher.pushWithoutNotification(getHistoryChunk(i).cloneToSharedChunk());
+    }
+    queuePusher.notify();
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    return getMembers()->m_history.size();
+    return getMembers()->m_historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -339,17 +563,30 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    // all entries are released, independent of start and size, in order to not depend on their consistency when
+    // RouDi cleans up after an application crash; releasing an empty entry does nothing
     for (auto& unmanagedChunk : getMembers()->m_history)
     {
         unmanagedChunk.releaseToSharedChunk();
     }
 
-    getMembers()->m_history.clear();
+    getMembers()->m_historyStart = 0U;
+    getMembers()->m_historySize = 0U;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
+    // the sender was terminated and cannot use a queue snapshot anymore; without resetting the announcement, RouDi
+    // would wait for the grace period when it removes the queues
+    getMembers()->m_queueSnapshotInUse.store(MemberType_t::NO_QUEUE_SNAPSHOT_IN_USE, std::memory_order_release);
+
+    // the queues are detached when the sender stops offering, therefore no receiver reads the ring anymore
+    if (getMembers()->m_broadcastRing)
+    {
+        BroadcastRingWriter(getMembers()->m_broadcastRing.get()).releaseAll();
+    }
+
     if (getMembers()->tryLock())
     {
         clearHistory();
@@ -358,13 +595,136 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     else
     {
         /// @todo iox-#1711 currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
+        /// and a sending application dies when having the lock for adding a chunk to the history. If the RouDi daemon
+        /// wants to cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
+        /// As long as we don't have a lock-free history or another concept we die here
         IOX_REPORT_FATAL(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION);
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::tryAttachToBroadcastRing(not_null<ChunkQueueData_t* const> queue,
+                                                                     const uint64_t requestedHistory) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    // a blocking queue needs the chunks pushed in order to throttle the sender
+    const bool isBlockingQueue =
+        (getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER
+         && queueData->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+    if (!getMembers()->m_broadcastRing || isBlockingQueue)
+    {
+        return false;
+    }
+
+    const auto numberOfHistoryChunks = algorithm::minVal(requestedHistory, getMembers()->m_historySize);
+    if (!BroadcastRingWriter(getMembers()->m_broadcastRing.get())
+             .attach(queueData->m_broadcastRingCursor, numberOfHistoryChunks))
+    {
+        return false;
+    }
+
+    if (numberOfHistoryChunks > 0U)
+    {
+        ChunkQueuePusher_t(queue).notify();
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::detachFromBroadcastRing(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    if (getMembers()->m_broadcastRing)
+    {
+        ChunkQueueData_t* const queueData = queue;
+        BroadcastRingWriter(getMembers()->m_broadcastRing.get()).detach(queueData->m_broadcastRingCursor);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::isAttachedToBroadcastRing(const ChunkQueueData_t& queue) const noexcept
+{
+    return getMembers()->m_broadcastRing
+           && BroadcastRingWriter(getMembers()->m_broadcastRing.get()).isAttached(queue.m_broadcastRingCursor);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::writeToBroadcastRing(mepoo::SharedChunk chunk) noexcept
+{
+    if (getMembers()->m_broadcastRing)
+    {
+        BroadcastRingWriter(getMembers()->m_broadcastRing.get()).push(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::enterQueueSnapshot() const noexcept
+{
+    // the snapshot is announced before it is checked again whether it is still the active one; with the sequentially
+    // consistent ordering either RouDi sees the announcement or the sender sees the newly published snapshot
+    auto snapshot = getMembers()->m_activeQueueSnapshot.load(std::memory_order_seq_cst);
+    while (true)
+    {
+        getMembers()->m_queueSnapshotInUse.store(snapshot, std::memory_order_seq_cst);
+        const auto activeSnapshot = getMembers()->m_activeQueueSnapshot.load(std::memory_order_seq_cst);
+        if (activeSnapshot == snapshot)
+        {
+            return getMembers()->m_queueSnapshots[snapshot];
+        }
+        snapshot = activeSnapshot;
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::leaveQueueSnapshot() const noexcept
+{
+    getMembers()->m_queueSnapshotInUse.store(MemberType_t::NO_QUEUE_SNAPSHOT_IN_USE, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+template <typename Modification>
+inline void ChunkDistributor<ChunkDistributorDataType>::updateQueueSnapshot(const Modification& modification) noexcept
+{
+    const auto previousSnapshot = getMembers()->m_activeQueueSnapshot.load(std::memory_order_relaxed);
+    const auto nextSnapshot = (previousSnapshot + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // the sender left the next snapshot at the latest during the grace period of the previous update
+    auto& nextQueues = getMembers()->m_queueSnapshots[nextSnapshot];
+    nextQueues = getMembers()->m_queueSnapshots[previousSnapshot];
+    modification(nextQueues);
+    rebuildQueueIndexLookup(nextSnapshot);
+    getMembers()->m_activeQueueSnapshot.store(nextSnapshot, std::memory_order_seq_cst);
+
+    // a sender which waits for a consumer uses the previous snapshot; it is woken up in order to continue with the
+    // next snapshot
+    if (getMembers()->m_queueSnapshotInUse.load(std::memory_order_seq_cst) == previousSnapshot)
+    {
+        for (auto& queue : getMembers()->m_queueSnapshots[previousSnapshot])
+        {
+            ChunkQueuePusher_t(queue.get()).wakeUpWaitingProducers();
+        }
+    }
+
+    // grace period; a removed queue might be destroyed after this call, therefore the sender must not use the previous
+    // snapshot anymore
+    deadline_timer gracePeriod{QUEUE_SNAPSHOT_GRACE_PERIOD};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (getMembers()->m_queueSnapshotInUse.load(std::memory_order_seq_cst) == previousSnapshot)
+    {
+        if (gracePeriod.hasExpired())
+        {
+            IOX_LOG(Warn,
+                    "The sender did not leave the queue snapshot within the grace period! It is assumed that the "
+                    "sender was terminated while delivering a chunk.");
+            break;
+        }
+        adaptiveWait.wait();
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -18,22 +18,40 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_DATA_HPP
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/atomic.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
+#include <limits>
 #include <mutex>
+#include <type_traits>
 
 namespace iox
 {
 namespace popo
 {
+namespace detail
+{
+/// @brief the smallest power of two which is at least twice the number of queues
+constexpr uint32_t queueIndexLookupCapacity(const uint32_t maxQueues) noexcept
+{
+    uint32_t lookupCapacity{1U};
+    while (lookupCapacity < 2U * maxQueues)
+    {
+        lookupCapacity <<= 1U;
+    }
+    return lookupCapacity;
+}
+} // namespace detail
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 struct ChunkDistributorData : public LockingPolicy
 {
@@ -48,16 +66,45 @@ struct ChunkDistributorData : public LockingPolicy
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    static constexpr uint32_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    static constexpr uint32_t NO_QUEUE_SNAPSHOT_IN_USE{NUMBER_OF_QUEUE_SNAPSHOTS};
+
+    /// The queues are double buffered in order to deliver chunks without the lock. The sender reads the snapshot
+    /// 'm_activeQueueSnapshot' and announces it in 'm_queueSnapshotInUse'. RouDi modifies a copy in the other buffer
+    /// under the lock, publishes it by switching 'm_activeQueueSnapshot' and waits until the sender left the previous
+    /// snapshot before the modification is complete.
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    concurrent::Atomic<uint32_t> m_activeQueueSnapshot{0U};
+    mutable concurrent::Atomic<uint32_t> m_queueSnapshotInUse{NO_QUEUE_SNAPSHOT_IN_USE};
 
-    /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
+    using QueueIndex_t = std::conditional_t<(ChunkDistributorDataProperties_t::MAX_QUEUES
+                                             < std::numeric_limits<uint16_t>::max()),
+                                            uint16_t,
+                                            uint32_t>;
+    static constexpr QueueIndex_t NO_QUEUE_INDEX{std::numeric_limits<QueueIndex_t>::max()};
+    static constexpr uint32_t QUEUE_INDEX_LOOKUP_CAPACITY{
+        detail::queueIndexLookupCapacity(ChunkDistributorDataProperties_t::MAX_QUEUES)};
+
+    /// Maps the unique id of a queue to its index in the snapshot with the same index in order to find the queue of a
+    /// response without iterating over the snapshot. The lookup uses open addressing with linear probing and is
+    /// rebuilt together with its snapshot, therefore it is read without the lock like the snapshot.
+    QueueIndex_t m_queueIndexLookups[NUMBER_OF_QUEUE_SNAPSHOTS][QUEUE_INDEX_LOOKUP_CAPACITY];
+
+    /// @todo iox-#1710 If we would make the history of the ChunkDistributor lock-free, can we than extend the
+    /// UsedChunkList to be like a ring buffer and use this for the history? This would be needed to be able to safely
+    /// cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
     /// crash.
-    using HistoryContainer_t =
-        vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
-    HistoryContainer_t m_history;
+    /// The history is a ring buffer with 'm_historySize' chunks starting with the oldest one at 'm_historyStart'; when
+    /// the history is full, the oldest chunk is replaced in place by the new one.
+    mepoo::ShmSafeUnmanagedChunk m_history[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    uint64_t m_historyStart{0U};
+    uint64_t m_historySize{0U};
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// Optional ring which is owned by the port; the chunks are written once into the ring and the attached queues read
+    /// them with their own cursor instead of getting them pushed
+    RelativePointer<BroadcastRingData> m_broadcastRing;
 };
 
 } // namespace popo
@@ -40,6 +40,14 @@ inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, Chunk
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
     , m_consumerTooSlowPolicy(policy)
 {
+    for (auto& queueIndexLookup : m_queueIndexLookups)
+    {
+        for (auto& queueIndex : queueIndexLookup)
+        {
+            queueIndex = NO_QUEUE_INDEX;
+        }
+    }
+
     if (m_historyCapacity != historyCapacity)
     {
         IOX_LOG(Warn, "Chunk history too large, reducing from " << historyCapacity << " to " << m_historyCapacity);
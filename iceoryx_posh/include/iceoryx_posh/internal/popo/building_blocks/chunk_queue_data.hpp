@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
@@ -47,9 +48,18 @@ struct ChunkQueueData : public LockingPolicy
     VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     concurrent::Atomic<bool> m_queueHasLostChunks{false};
 
+    /// A sender with a broadcast ring does not push its chunks into the queue but the receiver reads them from the ring
+    /// with this cursor
+    BroadcastRingCursorData m_broadcastRingCursor;
+
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// Producers which are blocked by a full queue wait on this semaphore until the consumer pops a chunk; it is only
+    /// created for queues with QueueFullPolicy::BLOCK_PRODUCER
+    optional<build::InterProcessSemaphore> m_spaceAvailableSemaphore;
+    concurrent::Atomic<uint32_t> m_numberOfWaitingProducers{0U};
 };
 
 } // namespace popo
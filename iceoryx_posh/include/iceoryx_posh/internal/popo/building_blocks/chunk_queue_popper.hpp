@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_HPP
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_reader.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/not_null.hpp"
@@ -31,7 +32,8 @@ namespace popo
 /// principle. Together with the ChunkDistributor and the ChunkQueuePusher, the ChunkQueuePopper builds the
 /// infrastructure to exchange memory chunks between different data producers and consumers that could be located in
 /// different processes. A ChunkQueuePopper is used to build elements of higher abstraction layers that also do memory
-/// managemet and provide an API towards the real user
+/// managemet and provide an API towards the real user. When the queue is attached to the broadcast ring of a sender,
+/// the chunks of the ring are popped after the chunks of the queue.
 template <typename ChunkQueueDataType>
 class ChunkQueuePopper
 {
@@ -50,6 +52,13 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop multiple chunks from the chunk queue in one pass
+    /// @param[out] chunks, array with at least maxNumberOfChunks elements for the popped chunks
+    /// @param[in] maxNumberOfChunks, the maximum number of chunks to pop
+    /// @return the number of popped chunks which are stored at the beginning of the array; chunks with an incompatible
+    /// ChunkHeader are dropped and not counted
+    uint32_t tryPopBatch(mepoo::SharedChunk* const chunks, const uint32_t maxNumberOfChunks) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -97,6 +106,15 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief wakes up a producer which waits for space in a full queue
+    void wakeUpWaitingProducer() noexcept;
+
+    /// @brief checks the ChunkHeader version of a popped chunk
+    /// @return true if the chunk can be handed over to the user, false if it has to be dropped
+    static bool hasCompatibleChunkHeader(const mepoo::SharedChunk& chunk) noexcept;
+
+    BroadcastRingReader getBroadcastRingReader() const noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -53,48 +53,105 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        wakeUpWaitingProducer();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        if (!hasCompatibleChunkHeader(chunk))
         {
-            IOX_LOG(Error,
-                    "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
-                                                                 << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
-                                                                 << "'! Dropping chunk!");
-            IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                       iox::er::RUNTIME_ERROR);
             return nullopt_t();
         }
         return make_optional<mepoo::SharedChunk>(chunk);
     }
-    else
+
+    auto chunk = getBroadcastRingReader().tryPop();
+    if (chunk.has_value() && !hasCompatibleChunkHeader(chunk.value()))
     {
         return nullopt_t();
     }
+    return chunk;
+}
+
+template <typename ChunkQueueDataType>
+inline uint32_t ChunkQueuePopper<ChunkQueueDataType>::tryPopBatch(mepoo::SharedChunk* const chunks,
+                                                                  const uint32_t maxNumberOfChunks) noexcept
+{
+    uint32_t numberOfChunks{0U};
+    while (numberOfChunks < maxNumberOfChunks)
+    {
+        auto retVal = getMembers()->m_queue.pop();
+        if (!retVal.has_value())
+        {
+            break;
+        }
+
+        wakeUpWaitingProducer();
+
+        auto chunk = retVal.value().releaseToSharedChunk();
+        if (hasCompatibleChunkHeader(chunk))
+        {
+            chunks[numberOfChunks] = chunk;
+            ++numberOfChunks;
+        }
+    }
+
+    auto broadcastRingReader = getBroadcastRingReader();
+    while (numberOfChunks < maxNumberOfChunks)
+    {
+        auto chunk = broadcastRingReader.tryPop();
+        if (!chunk.has_value())
+        {
+            break;
+        }
+
+        if (hasCompatibleChunkHeader(chunk.value()))
+        {
+            chunks[numberOfChunks] = chunk.value();
+            ++numberOfChunks;
+        }
+    }
+    return numberOfChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::hasCompatibleChunkHeader(const mepoo::SharedChunk& chunk) noexcept
+{
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        IOX_LOG(Error,
+                "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                                                             << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
+                                                             << "'! Dropping chunk!");
+        IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                   iox::er::RUNTIME_ERROR);
+        return false;
+    }
+    return true;
 }
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
+    bool hasLostChunks = getBroadcastRingReader().hasLostChunks();
     if (getMembers()->m_queueHasLostChunks.load(std::memory_order_relaxed))
     {
         getMembers()->m_queueHasLostChunks.store(false, std::memory_order_relaxed);
-        return true;
+        hasLostChunks = true;
     }
-    return false;
+    return hasLostChunks;
 }
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
-    return getMembers()->m_queue.empty();
+    return getMembers()->m_queue.empty() && getBroadcastRingReader().empty();
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
-    return getMembers()->m_queue.size();
+    return getMembers()->m_queue.size() + getBroadcastRingReader().size();
 }
 
 template <typename ChunkQueueDataType>
@@ -123,6 +180,31 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        wakeUpWaitingProducer();
+    }
+    getBroadcastRingReader().clear();
+}
+
+template <typename ChunkQueueDataType>
+inline BroadcastRingReader ChunkQueuePopper<ChunkQueueDataType>::getBroadcastRingReader() const noexcept
+{
+    return BroadcastRingReader(&m_chunkQueueDataPtr->m_broadcastRingCursor);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducer() noexcept
+{
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the fence of a producer which registers itself as waiting before it checks the queue again
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed) > 0U)
+    {
+        getMembers()->m_spaceAvailableSemaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_POST); });
     }
 }
 
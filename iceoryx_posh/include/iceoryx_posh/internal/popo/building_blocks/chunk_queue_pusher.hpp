@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
@@ -50,9 +51,26 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying an attached condition variable; used to push
+    /// multiple chunks followed by a single call to 'notify'
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notify the condition variable which is attached to the chunk queue, if there is one
+    void notify() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief blocks a producer of a queue with QueueFullPolicy::BLOCK_PRODUCER until the consumer popped a chunk,
+    /// 'wakeUpWaitingProducers' is called or the timeout passed; returns immediately if the queue is not full
+    /// @param[in] timeout is the maximum time to wait
+    void waitUntilNotFull(const units::Duration timeout) noexcept;
+
+    /// @brief wakes up all producers which wait in 'waitUntilNotFull', e.g. because the queue is removed
+    void wakeUpWaitingProducers() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -44,6 +44,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const auto hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -56,23 +64,66 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
+{
+    getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitUntilNotFull(const units::Duration timeout) noexcept
+{
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    // the queue is checked again after the producer is registered; with the fence, either the consumer sees the
+    // registration after it popped a chunk or the producer sees the popped chunk
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (getMembers()->m_queue.size() >= getMembers()->m_queue.capacity())
+    {
+        if (getMembers()->m_spaceAvailableSemaphore->timedWait(timeout).has_error())
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
+            IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_WAIT);
         }
     }
 
-    return !hasQueueOverflow;
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
 }
 
 template <typename ChunkQueueDataType>
-inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
 {
-    getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    if (!getMembers()->m_spaceAvailableSemaphore.has_value())
+    {
+        return;
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < numberOfWaitingProducers; ++i)
+    {
+        getMembers()->m_spaceAvailableSemaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_POST); });
+    }
 }
 
 } // namespace popo
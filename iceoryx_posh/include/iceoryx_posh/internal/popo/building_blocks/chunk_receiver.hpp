@@ -78,6 +78,17 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get multiple received chunks in one pass over the underlying queue. The number of chunks is
+    /// limited by maxNumberOfChunks and by the chunks the user can still hold in parallel. Like with tryGet, the
+    /// ownership of the SharedChunks remains in the ChunkReceiver
+    /// @param[out] chunkHeaders, array with at least maxNumberOfChunks elements for the pointers to the ChunkHeaders;
+    /// the chunks are stored in the order of the queue
+    /// @param[in] maxNumberOfChunks, the maximum number of chunks to get
+    /// @return number of received chunks, ChunkReceiveResult on error or if there are no new chunks in the underlying
+    /// queue
+    expected<uint32_t, ChunkReceiveResult> tryGetBatch(const mepoo::ChunkHeader** const chunkHeaders,
+                                                       const uint32_t maxNumberOfChunks) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/algorithm.hpp"
 
 namespace iox
 {
@@ -76,10 +77,14 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
 
     if (popRet.has_value())
     {
-        auto sharedChunk = *popRet;
+        auto& sharedChunk = popRet.value();
+        // the chunk is reclaimed via the ownership ledger until it is in the list of used chunks
+        getMembers()->m_ownershipLedger.record(sharedChunk);
 
         // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        const bool isInserted = getMembers()->m_chunksInUse.insert(sharedChunk);
+        getMembers()->m_ownershipLedger.clear();
+        if (isInserted)
         {
             return ok(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -93,6 +98,57 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint32_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(const mepoo::ChunkHeader** const chunkHeaders,
+                                                  const uint32_t maxNumberOfChunks) noexcept
+{
+    if (maxNumberOfChunks == 0U)
+    {
+        return ok(0U);
+    }
+
+    const auto numberOfFreeEntries = getMembers()->m_chunksInUse.numberOfFreeEntries();
+    if (numberOfFreeEntries == 0U)
+    {
+        // the application holds too many chunks; tryGet handles the next chunk of the queue the same way as without
+        // batching
+        auto getRet = tryGet();
+        if (getRet.has_error())
+        {
+            return err(getRet.error());
+        }
+        chunkHeaders[0] = getRet.value();
+        return ok(1U);
+    }
+
+    // the chunks are released when they go out of scope without being inserted into the list of used chunks
+    mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_IN_USE];
+
+    // only as many chunks are popped as can be inserted into the list of used chunks, so no chunk is dropped
+    const auto numberOfChunks =
+        this->tryPopBatch(&chunks[0], algorithm::minVal(maxNumberOfChunks, numberOfFreeEntries));
+    if (numberOfChunks == 0U)
+    {
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    // the chunks are reclaimed via the ownership ledger until they are in the list of used chunks
+    getMembers()->m_ownershipLedger.record(&chunks[0], numberOfChunks);
+    const bool areInserted = getMembers()->m_chunksInUse.insert(&chunks[0], numberOfChunks);
+    getMembers()->m_ownershipLedger.clear();
+    if (!areInserted)
+    {
+        return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+    }
+    return ok(numberOfChunks);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -108,6 +164,7 @@ template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_ownershipLedger.cleanup();
     this->clear();
 }
 
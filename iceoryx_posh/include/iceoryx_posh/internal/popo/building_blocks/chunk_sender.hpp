@@ -104,6 +104,26 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate multiple chunks with the same settings in one pass; the chunks are obtained from the
+    /// MemoryManager and inserted into the list of used chunks with one operation each
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a
+    /// user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @param[out] chunkHeaders, array with at least numberOfChunks elements for the pointers to the ChunkHeaders
+    /// @param[in] numberOfChunks, number of chunks to allocate
+    /// @return on success all chunks are allocated, on error none of them
+    expected<void, AllocationError> tryAllocateBatch(const UniquePortId originId,
+                                                     const uint64_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment,
+                                                     const uint32_t userHeaderSize,
+                                                     const uint32_t userHeaderAlignment,
+                                                     mepoo::ChunkHeader** const chunkHeaders,
+                                                     const uint32_t numberOfChunks) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -114,6 +134,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks to all connected ChunkQueuePopper; each queue is notified only once
+    /// @param[in] chunkHeaders, array with the pointers to the ChunkHeaders to send in this order; the ownership of the
+    /// pointers is transferred to this method
+    /// @param[in] numberOfChunks, number of chunks in the array
+    /// @return the number of deliveries, i.e. the sum of the number of receivers each chunk was send to
+    uint64_t sendBatch(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -143,6 +170,7 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader of the chunk that shall be send
     /// @param[in][out] chunk that corresponds to the chunk header
     /// @return true if there was a matching chunk with this header, false if not
+    /// @note the chunk is recorded in the ownership ledger which must be cleared once the chunk is handed over
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
     const MemberType_t* getMembers() const noexcept;
@@ -123,7 +123,10 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     if (lastChunkChunkHeader && (lastChunkChunkHeader->chunkSize() >= requiredChunkSize))
     {
         auto sharedChunk = lastChunkUnmanaged.cloneToSharedChunk();
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        getMembers()->m_ownershipLedger.record(sharedChunk);
+        const bool isInserted = getMembers()->m_chunksInUse.insert(sharedChunk);
+        getMembers()->m_ownershipLedger.clear();
+        if (isInserted)
         {
             auto chunkSize = lastChunkChunkHeader->chunkSize();
             lastChunkChunkHeader->~ChunkHeader();
@@ -140,7 +143,9 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_useChunkMagazine
+                                  ? getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkMagazine)
+                                  : getMembers()->m_memoryMgr->getChunk(chunkSettings);
 
         if (getChunkResult.has_error())
         {
@@ -149,11 +154,15 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         }
 
         auto& chunk = getChunkResult.value();
+        getMembers()->m_ownershipLedger.record(chunk);
+        // END of critical section, the chunk is reclaimed via the ownership ledger until it is in the list of used
+        // chunks
 
         // if the application allocated too much chunks, return no more chunks
-        if (getMembers()->m_chunksInUse.insert(chunk))
+        const bool isInserted = getMembers()->m_chunksInUse.insert(chunk);
+        getMembers()->m_ownershipLedger.clear();
+        if (isInserted)
         {
-            // END of critical section
             chunk.getChunkHeader()->setOriginId(originId);
             return ok(chunk.getChunkHeader());
         }
@@ -166,6 +175,58 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline expected<void, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateBatch(const UniquePortId originId,
+                                                   const uint64_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment,
+                                                   mepoo::ChunkHeader** const chunkHeaders,
+                                                   const uint32_t numberOfChunks) noexcept
+{
+    if (numberOfChunks > MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    // the chunks are released when they go out of scope without being inserted into the list of used chunks
+    mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY];
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    auto getChunksResult =
+        getMembers()->m_memoryMgr->getChunks(chunkSettingsResult.value(), &chunks[0], numberOfChunks);
+    if (getChunksResult.has_error())
+    {
+        return err(into<AllocationError>(getChunksResult.error()));
+    }
+    getMembers()->m_ownershipLedger.record(&chunks[0], numberOfChunks);
+    // END of critical section, the chunks are reclaimed via the ownership ledger until they are in the list of used
+    // chunks
+
+    // if the application allocated too much chunks, return no more chunks
+    const bool areInserted = getMembers()->m_chunksInUse.insert(&chunks[0], numberOfChunks);
+    getMembers()->m_ownershipLedger.clear();
+    if (!areInserted)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+        chunkHeaders[i]->setOriginId(originId);
+    }
+    return ok();
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -182,36 +243,71 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
 {
     uint64_t numberOfReceiverTheChunkWasDelivered{0};
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the chunk is recorded in the ownership ledger while it is delivered
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        getMembers()->m_ownershipLedger.clear();
     }
-    // END of critical section
 
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendBatch(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                            const uint32_t numberOfChunks) noexcept
+{
+    uint64_t numberOfDeliveries{0U};
+    // there cannot be more valid chunks than chunks in use, but the array is processed in slices in order to report
+    // every invalid chunk header
+    for (uint32_t offset = 0U; offset < numberOfChunks; offset += MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY)
+    {
+        const auto sliceSize = std::min(numberOfChunks - offset, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY);
+
+        mepoo::SharedChunk chunks[MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY];
+        uint32_t numberOfChunksReadyForSend{0U};
+        // the chunks are recorded in the ownership ledger while they are delivered
+        for (uint32_t i = 0U; i < sliceSize; ++i)
+        {
+            if (getChunkReadyForSend(chunkHeaders[offset + i], chunks[numberOfChunksReadyForSend]))
+            {
+                ++numberOfChunksReadyForSend;
+            }
+        }
+
+        if (numberOfChunksReadyForSend > 0U)
+        {
+            numberOfDeliveries += this->deliverToAllStoredQueues(&chunks[0], numberOfChunksReadyForSend);
+
+            getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+            getMembers()->m_lastChunkUnmanaged = chunks[numberOfChunksReadyForSend - 1U];
+            getMembers()->m_ownershipLedger.clear();
+        }
+    }
+
+    return numberOfDeliveries;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the chunk is recorded in the ownership ledger while it is delivered
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        getMembers()->m_ownershipLedger.clear();
 
         return !deliveryResult.has_error();
     }
-    // END of critical section
 
     return false;
 }
@@ -220,15 +316,15 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
-    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // the chunk is recorded in the ownership ledger while it is added to the history
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         this->addToHistoryWithoutDelivery(chunk);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
+        getMembers()->m_ownershipLedger.clear();
     }
-    // END of critical section
 }
 
 template <typename ChunkSenderDataType>
@@ -248,16 +344,22 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_ownershipLedger.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunkMagazine.drain();
 }
 
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader,
                                                                    mepoo::SharedChunk& chunk) noexcept
 {
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
+        getMembers()->m_ownershipLedger.record(chunk);
+        // END of critical section, the chunk is reclaimed via the ownership ledger until it is handed over; the
+        // ledger must be cleared by the caller
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
         return true;
     }
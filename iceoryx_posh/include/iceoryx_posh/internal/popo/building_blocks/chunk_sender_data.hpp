@@ -18,9 +18,11 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/chunk_ownership_ledger.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/not_null.hpp"
@@ -36,15 +38,22 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool useChunkMagazine = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
+    /// @brief records the chunks which are on the way between the mempool, the UsedChunkList and the queues
+    ChunkOwnershipLedger<MaxChunksAllocatedSimultaneously> m_ownershipLedger;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    const bool m_useChunkMagazine{false};
+    mepoo::ChunkMagazine m_chunkMagazine;
 };
 
 } // namespace popo
@@ -26,10 +26,12 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool useChunkMagazine) noexcept
     : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_useChunkMagazine(useChunkMagazine)
 {
 }
 
@@ -70,10 +70,9 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    NotificationVector_t waitImpl(const function_ref<bool(const uint32_t)> waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
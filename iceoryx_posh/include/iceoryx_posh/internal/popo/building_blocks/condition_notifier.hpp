@@ -44,6 +44,9 @@ class ConditionNotifier
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
+  private:
+    void wakeUpListener() noexcept;
+
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     uint64_t m_notificationIndex = INVALID_NOTIFICATION_INDEX;
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_VARIABLE_DATA_HPP
 
+#include "iceoryx_platform/futex.hpp"
 #include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -30,6 +31,12 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+    static_assert(NUMBER_OF_NOTIFICATION_WORDS <= NOTIFICATIONS_PER_WORD,
+                  "The summary of the active notification words supports at most 4096 notifiers");
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -39,11 +46,29 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief returns the address of m_wakeUpGeneration for the futex syscalls
+    uint32_t* futexWord() noexcept;
+
+    /// @brief returns true when the notification with the given index was notified but not yet collected
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
+    /// @brief the wait primitive of the ConditionListener on platforms without futex, i.e. when
+    ///        IOX_FUTEX_AVAILABLE is false; it is not created otherwise
     optional<build::InterProcessSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     concurrent::Atomic<bool> m_toBeDestroyed{false};
-    concurrent::Atomic<bool> m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief the active notifications as bitmap; the notification with index i is bit i % 64 of word i / 64
+    concurrent::Atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
+    /// @brief bit i is set when word i of m_activeNotifications may contain an active notification; it is set after
+    ///        the notification bit, therefore a listener which sees the summary bit also sees the notification
+    concurrent::Atomic<uint64_t> m_activeNotificationWords{0U};
     concurrent::Atomic<bool> m_wasNotified{false};
+    /// @brief is set by the ConditionListener before it blocks; a ConditionNotifier wakes up the listener only when
+    ///        it resets this flag, therefore a burst of notifications costs a single syscall
+    concurrent::Atomic<bool> m_isListenerWaiting{false};
+    /// @brief the futex word on platforms with futex; it is incremented whenever the listener is woken up and the
+    ///        listener blocks only as long as the generation it read before it collected the notifications is current
+    concurrent::Atomic<uint32_t> m_wakeUpGeneration{0U};
 };
 
 } // namespace popo
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared memory data via which the ports notify the discovery loop of RouDi about a change of their CaPro state.
+/// A port sets its bit in 'm_changedPorts' and wakes up the discovery loop, which then processes only the ports with a
+/// set bit. The bit of a port is its position in the container of the port pool plus the offset of its port type.
+struct DiscoveryNotificationData
+{
+    DiscoveryNotificationData() noexcept;
+
+    DiscoveryNotificationData(const DiscoveryNotificationData&) = delete;
+    DiscoveryNotificationData(DiscoveryNotificationData&&) = delete;
+    DiscoveryNotificationData& operator=(const DiscoveryNotificationData&) = delete;
+    DiscoveryNotificationData& operator=(DiscoveryNotificationData&&) = delete;
+    ~DiscoveryNotificationData() noexcept = default;
+
+    static constexpr uint64_t PUBLISHER_OFFSET{0U};
+    static constexpr uint64_t SUBSCRIBER_OFFSET{PUBLISHER_OFFSET + MAX_PUBLISHERS};
+    static constexpr uint64_t SERVER_OFFSET{SUBSCRIBER_OFFSET + MAX_SUBSCRIBERS};
+    static constexpr uint64_t CLIENT_OFFSET{SERVER_OFFSET + MAX_SERVERS};
+    static constexpr uint64_t NUMBER_OF_PORTS{CLIENT_OFFSET + MAX_CLIENTS};
+
+    static constexpr uint64_t PORTS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(NUMBER_OF_PORTS + PORTS_PER_WORD - 1U) / PORTS_PER_WORD};
+
+    /// @brief the notification index of the ports at the condition variable
+    static constexpr uint64_t PORT_NOTIFICATION_INDEX{0U};
+    /// @brief the notification index with which RouDi triggers a run of the discovery loop itself
+    static constexpr uint64_t TRIGGER_NOTIFICATION_INDEX{1U};
+
+    ConditionVariableData m_conditionVariableData;
+    /// @brief the ports with a pending change as bitmap; the port with index i is bit i % 64 of word i / 64
+    concurrent::Atomic<uint64_t> m_changedPorts[NUMBER_OF_WORDS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
@@ -0,0 +1,46 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief DiscoveryNotifier marks a port as changed and wakes up the discovery loop of RouDi
+class DiscoveryNotifier
+{
+  public:
+    /// @param[in] discoveryNotificationData of the port pool the port belongs to
+    /// @param[in] portIndex of the port in the bitmap of the changed ports
+    DiscoveryNotifier(DiscoveryNotificationData& discoveryNotificationData, const uint64_t portIndex) noexcept;
+
+    /// @brief Marks the port as changed and wakes up the discovery loop
+    void notify() noexcept;
+
+  private:
+    DiscoveryNotificationData* m_discoveryNotificationDataPtr{nullptr};
+    uint64_t m_portIndex{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
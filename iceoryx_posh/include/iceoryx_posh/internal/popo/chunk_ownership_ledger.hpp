@@ -0,0 +1,79 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_HPP
+#define IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iox/atomic.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This class records the chunks which the application of a port owns outside of the shared memory structures
+///        of the port, i.e. while a chunk is moved between the mempool, the UsedChunkList and the queues. Without the
+///        record, such a chunk would leak if the application terminates in this moment.
+///        The record does not own a reference of the chunk, the reference stays with the SharedChunk of the
+///        application. It must therefore be cleared before this SharedChunk is destroyed or handed over. In case the
+///        application terminates unexpectedly, RouDi uses 'cleanup' to release the references of the recorded chunks.
+///        Since a port is used only by one thread at a time, the records are not nested and the reclaim is bounded by
+///        the number of chunks the application held in the moment of its termination.
+/// @note The recorded chunks are stored as ShmSafeUnmanagedChunk in order to prevent torn writes
+template <uint32_t Capacity>
+class ChunkOwnershipLedger
+{
+    static_assert(Capacity > 0, "ChunkOwnershipLedger Capacity must be larger than 0!");
+
+  public:
+    ChunkOwnershipLedger() noexcept = default;
+
+    /// @brief Records a chunk as owned by the application
+    /// @param[in] chunk to record; the SharedChunk keeps its reference
+    /// @note only from runtime context
+    void record(mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Records multiple chunks as owned by the application
+    /// @param[in] chunks is an array with the chunks to record; the SharedChunks keep their references
+    /// @param[in] numberOfChunks is the number of chunks in the array; must not exceed the capacity
+    /// @note only from runtime context
+    void record(mepoo::SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Removes all records; must be called before the recorded SharedChunks are destroyed or handed over
+    /// @note only from runtime context
+    void clear() noexcept;
+
+    /// @brief Releases the references of all recorded chunks and accounts them as leaked chunks of their MemPools
+    /// @return the number of released chunks
+    /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
+    /// still running.
+    uint32_t cleanup() noexcept;
+
+  private:
+    concurrent::AtomicFlag m_synchronizer = ATOMIC_FLAG_INIT;
+    uint32_t m_numberOfRecords{0U};
+    mepoo::ShmSafeUnmanagedChunk m_records[Capacity];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/chunk_ownership_ledger.inl"
+
+#endif // IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_HPP
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_INL
+#define IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_INL
+
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/popo/chunk_ownership_ledger.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <uint32_t Capacity>
+inline void ChunkOwnershipLedger<Capacity>::record(mepoo::SharedChunk& chunk) noexcept
+{
+    record(&chunk, 1U);
+}
+
+template <uint32_t Capacity>
+inline void ChunkOwnershipLedger<Capacity>::record(mepoo::SharedChunk* const chunks,
+                                                   const uint32_t numberOfChunks) noexcept
+{
+    IOX_ENFORCE(m_numberOfRecords + numberOfChunks <= Capacity, "Too many chunks to record!");
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        if (!chunks[i])
+        {
+            continue;
+        }
+        // the record is created from the ChunkManagement of the SharedChunk which afterwards takes it back; this way
+        // the reference counter is not touched
+        auto* chunkManagement = chunks[i].release();
+        m_records[m_numberOfRecords] = mepoo::ShmSafeUnmanagedChunk(mepoo::SharedChunk(chunkManagement));
+        chunks[i] = mepoo::SharedChunk(chunkManagement);
+        ++m_numberOfRecords;
+    }
+
+    m_synchronizer.clear(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline void ChunkOwnershipLedger<Capacity>::clear() noexcept
+{
+    for (uint32_t i = 0U; i < m_numberOfRecords; ++i)
+    {
+        m_records[i] = mepoo::ShmSafeUnmanagedChunk();
+    }
+    m_numberOfRecords = 0U;
+
+    m_synchronizer.clear(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChunkOwnershipLedger<Capacity>::cleanup() noexcept
+{
+    m_synchronizer.test_and_set(std::memory_order_acquire);
+
+    // all records are checked since the application might have terminated before the number of records was updated
+    uint32_t numberOfReleasedChunks{0U};
+    for (auto& record : m_records)
+    {
+        if (!record.isLogicalNullptr())
+        {
+            auto* chunkManagement = record.releaseToSharedChunk().release();
+            chunkManagement->m_mempool->incrementLeakedChunks();
+            // release the reference of the terminated application by creating a SharedChunk
+            mepoo::SharedChunk releasedChunk(chunkManagement);
+            ++numberOfReleasedChunks;
+        }
+    }
+    m_numberOfRecords = 0U;
+
+    return numberOfReleasedChunks;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CHUNK_OWNERSHIP_LEDGER_INL
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_DATA_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_DATA_HPP
+
+#include "iox/atomic.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueData is the user-payload of the chunk of a LatestValuePublisher. It holds only the newest
+/// value which is overwritten in place and protected by a sequence lock, i.e. the sequence number is odd while the
+/// single writer updates the value and the readers retry when the sequence number changed during their copy.
+/// @param[in] T type of the value; must be trivially copyable since it is copied while it might be overwritten and
+/// default constructible to have a destination for the copy
+template <typename T>
+class LatestValueData
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The value of a latest value topic must be trivially copyable");
+    static_assert(std::is_default_constructible<T>::value,
+                  "The value of a latest value topic must be default constructible");
+
+  public:
+    /// @brief sequence number of a LatestValueData which has not yet been written
+    static constexpr uint64_t NO_VALUE_SEQUENCE_NUMBER{0U};
+
+    LatestValueData() noexcept = default;
+
+    LatestValueData(const LatestValueData&) = delete;
+    LatestValueData(LatestValueData&&) = delete;
+    LatestValueData& operator=(const LatestValueData&) = delete;
+    LatestValueData& operator=(LatestValueData&&) = delete;
+    ~LatestValueData() noexcept = default;
+
+    /// @brief overwrites the value; must only be called by the single writer
+    /// @param[in] value to store
+    void write(const T& value) noexcept;
+
+    /// @brief copies the newest value without blocking the writer
+    /// @param[out] sequenceNumber of the copied value; stays untouched if there is no value yet
+    /// @return the newest value or nullopt if there was not yet a value written
+    optional<T> read(uint64_t& sequenceNumber) const noexcept;
+
+    /// @brief the sequence number of the newest value; changes with every write
+    /// @return the current sequence number; NO_VALUE_SEQUENCE_NUMBER if there is not yet a value
+    uint64_t sequenceNumber() const noexcept;
+
+  private:
+    concurrent::Atomic<uint64_t> m_sequenceNumber{NO_VALUE_SEQUENCE_NUMBER};
+    alignas(T) uint8_t m_value[sizeof(T)];
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/latest_value_data.inl"
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_DATA_HPP
@@ -0,0 +1,80 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_DATA_INL
+#define IOX_POSH_POPO_LATEST_VALUE_DATA_INL
+
+#include "iceoryx_posh/internal/popo/latest_value_data.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+inline void LatestValueData<T>::write(const T& value) noexcept
+{
+    const auto sequenceNumber = m_sequenceNumber.load(std::memory_order_relaxed);
+    m_sequenceNumber.store(sequenceNumber + 1U, std::memory_order_relaxed);
+    // the odd sequence number must be visible before any byte of the value is modified
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&m_value[0], &value, sizeof(T));
+    m_sequenceNumber.store(sequenceNumber + 2U, std::memory_order_release);
+}
+
+template <typename T>
+inline optional<T> LatestValueData<T>::read(uint64_t& sequenceNumber) const noexcept
+{
+    while (true)
+    {
+        const auto sequenceNumberBeforeCopy = m_sequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumberBeforeCopy == NO_VALUE_SEQUENCE_NUMBER)
+        {
+            return nullopt;
+        }
+
+        // the writer is in the middle of an update which is only a memcpy
+        if (sequenceNumberBeforeCopy % 2U == 1U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        T value;
+        std::memcpy(&value, &m_value[0], sizeof(T));
+        // the copy must be completed before the sequence number is checked again
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (m_sequenceNumber.load(std::memory_order_relaxed) == sequenceNumberBeforeCopy)
+        {
+            sequenceNumber = sequenceNumberBeforeCopy;
+            return value;
+        }
+    }
+}
+
+template <typename T>
+inline uint64_t LatestValueData<T>::sequenceNumber() const noexcept
+{
+    return m_sequenceNumber.load(std::memory_order_acquire);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_DATA_INL
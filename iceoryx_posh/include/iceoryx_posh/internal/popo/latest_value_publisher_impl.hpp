@@ -0,0 +1,70 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
+
+#include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/internal/popo/latest_value_data.hpp"
+#include "iox/expected.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValuePublisherImpl class implements the latest value publisher API
+/// @note Not intended for public usage! Use the 'LatestValuePublisher' instead!
+template <typename T, typename BasePublisherType = BasePublisher<>>
+class LatestValuePublisherImpl : public BasePublisherType
+{
+  public:
+    /// @brief Creates the publisher with a history capacity of one, which is required to hand the chunk with the
+    /// value to subscribers which join later.
+    explicit LatestValuePublisherImpl(const capro::ServiceDescription& service,
+                                      const PublisherOptions& publisherOptions = PublisherOptions()) noexcept;
+
+    virtual ~LatestValuePublisherImpl() = default;
+
+    LatestValuePublisherImpl(const LatestValuePublisherImpl& other) = delete;
+    LatestValuePublisherImpl& operator=(const LatestValuePublisherImpl&) = delete;
+    LatestValuePublisherImpl(LatestValuePublisherImpl&& rhs) noexcept = delete;
+    LatestValuePublisherImpl& operator=(LatestValuePublisherImpl&& rhs) noexcept = delete;
+
+    ///
+    /// @brief update Overwrites the latest value and notifies the subscribers.
+    /// @param value The new value.
+    /// @return Error if the chunk for the value could not be allocated with the first update.
+    /// @details Only the first update allocates and sends a chunk. All further updates overwrite the value in this
+    /// chunk in place, without allocating or queuing anything.
+    ///
+    expected<void, AllocationError> update(const T& value) noexcept;
+
+  protected:
+    using PortType = typename BasePublisherType::PortType;
+    using BasePublisherType::port;
+
+  private:
+    static PublisherOptions withHistory(const PublisherOptions& publisherOptions) noexcept;
+
+    LatestValueData<T>* m_data{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.inl"
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename BasePublisherType>
+inline LatestValuePublisherImpl<T, BasePublisherType>::LatestValuePublisherImpl(
+    const capro::ServiceDescription& service, const PublisherOptions& publisherOptions) noexcept
+    : BasePublisherType(service, withHistory(publisherOptions))
+{
+}
+
+template <typename T, typename BasePublisherType>
+inline PublisherOptions
+LatestValuePublisherImpl<T, BasePublisherType>::withHistory(const PublisherOptions& publisherOptions) noexcept
+{
+    auto options = publisherOptions;
+    if (options.historyCapacity == 0U)
+    {
+        options.historyCapacity = 1U;
+    }
+    return options;
+}
+
+template <typename T, typename BasePublisherType>
+inline expected<void, AllocationError> LatestValuePublisherImpl<T, BasePublisherType>::update(const T& value) noexcept
+{
+    if (m_data != nullptr)
+    {
+        m_data->write(value);
+        port().notifySubscribers();
+        return ok();
+    }
+
+    auto result = port().tryAllocateChunk(sizeof(LatestValueData<T>),
+                                          alignof(LatestValueData<T>),
+                                          CHUNK_NO_USER_HEADER_SIZE,
+                                          CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    auto* chunkHeader = result.value();
+    auto* data = new (chunkHeader->userPayload()) LatestValueData<T>();
+    data->write(value);
+    // the history keeps the chunk alive for the lifetime of the publisher, therefore it is safe to keep the pointer
+    port().sendChunk(chunkHeader);
+    m_data = data;
+    return ok();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
+
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/internal/popo/latest_value_data.hpp"
+#include "iox/optional.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueSubscriberImpl class implements the latest value subscriber API
+/// @note Not intended for public usage! Use the 'LatestValueSubscriber' instead!
+template <typename T, typename BaseSubscriberType = BaseSubscriber<>>
+class LatestValueSubscriberImpl : public BaseSubscriberType
+{
+    using SelfType = LatestValueSubscriberImpl<T, BaseSubscriberType>;
+
+  public:
+    /// @brief Creates the subscriber with a history request of one and only connects to publishers which support it,
+    /// i.e. the subscriber receives the chunk with the value even if it subscribes after the first update.
+    explicit LatestValueSubscriberImpl(const capro::ServiceDescription& service,
+                                       const SubscriberOptions& subscriberOptions = SubscriberOptions()) noexcept;
+
+    virtual ~LatestValueSubscriberImpl() noexcept;
+
+    LatestValueSubscriberImpl(const LatestValueSubscriberImpl& other) = delete;
+    LatestValueSubscriberImpl& operator=(const LatestValueSubscriberImpl&) = delete;
+    LatestValueSubscriberImpl(LatestValueSubscriberImpl&& rhs) noexcept = delete;
+    LatestValueSubscriberImpl& operator=(LatestValueSubscriberImpl&& rhs) noexcept = delete;
+
+    ///
+    /// @brief Copies the latest value of the publisher.
+    /// @return The latest value or nullopt if the publisher has not yet provided a value.
+    /// @details Reading the value does neither block the publisher nor touch any reference counter; only when a
+    /// publisher provides the chunk with its value, the chunk is taken from the receive queue. The same value can be
+    /// taken multiple times.
+    ///
+    optional<T> take() noexcept;
+
+    ///
+    /// @brief Check if there is a value which was not yet taken.
+    /// @return True if the value changed since the last take or a publisher provided a new chunk.
+    ///
+    bool hasData() const noexcept;
+
+    friend class NotificationAttorney;
+
+  protected:
+    using PortType = typename BaseSubscriberType::PortType;
+    using BaseSubscriberType::port;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the event corresponding
+    /// hasTriggered method callback; the state condition is satisfied when there is a value which was not yet taken
+    /// @param[in] subscriberState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const SubscriberState subscriberState) const noexcept;
+
+  private:
+    static SubscriberOptions withHistory(const SubscriberOptions& subscriberOptions) noexcept;
+
+    /// @brief takes all chunks from the receive queue and keeps the newest one
+    void updateChunk() noexcept;
+
+    const mepoo::ChunkHeader* m_chunkHeader{nullptr};
+    const LatestValueData<T>* m_data{nullptr};
+    uint64_t m_lastTakenSequenceNumber{LatestValueData<T>::NO_VALUE_SEQUENCE_NUMBER};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/latest_value_subscriber_impl.inl"
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
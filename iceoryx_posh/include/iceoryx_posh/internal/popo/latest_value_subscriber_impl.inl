@@ -0,0 +1,125 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
+#define IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/latest_value_subscriber_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename BaseSubscriberType>
+inline LatestValueSubscriberImpl<T, BaseSubscriberType>::LatestValueSubscriberImpl(
+    const capro::ServiceDescription& service, const SubscriberOptions& subscriberOptions) noexcept
+    : BaseSubscriberType(service, withHistory(subscriberOptions))
+{
+}
+
+template <typename T, typename BaseSubscriberType>
+inline LatestValueSubscriberImpl<T, BaseSubscriberType>::~LatestValueSubscriberImpl() noexcept
+{
+    BaseSubscriberType::m_trigger.reset();
+    if (m_chunkHeader != nullptr)
+    {
+        port().releaseChunk(m_chunkHeader);
+    }
+}
+
+template <typename T, typename BaseSubscriberType>
+inline SubscriberOptions
+LatestValueSubscriberImpl<T, BaseSubscriberType>::withHistory(const SubscriberOptions& subscriberOptions) noexcept
+{
+    auto options = subscriberOptions;
+    options.historyRequest = 1U;
+    options.requiresPublisherHistorySupport = true;
+    return options;
+}
+
+template <typename T, typename BaseSubscriberType>
+inline optional<T> LatestValueSubscriberImpl<T, BaseSubscriberType>::take() noexcept
+{
+    updateChunk();
+    if (m_data == nullptr)
+    {
+        return nullopt;
+    }
+    return m_data->read(m_lastTakenSequenceNumber);
+}
+
+template <typename T, typename BaseSubscriberType>
+inline bool LatestValueSubscriberImpl<T, BaseSubscriberType>::hasData() const noexcept
+{
+    if (port().hasNewChunks())
+    {
+        return true;
+    }
+    return m_data != nullptr && m_data->sequenceNumber() != m_lastTakenSequenceNumber;
+}
+
+template <typename T, typename BaseSubscriberType>
+inline void LatestValueSubscriberImpl<T, BaseSubscriberType>::updateChunk() noexcept
+{
+    while (true)
+    {
+        auto result = BaseSubscriberType::takeChunk();
+        if (result.has_error())
+        {
+            return;
+        }
+
+        const mepoo::ChunkHeader* chunkHeader = result.value();
+        if (chunkHeader->userPayloadSize() != sizeof(LatestValueData<T>))
+        {
+            IOX_LOG(Error,
+                    "The latest value subscriber received a chunk with a user-payload size of "
+                        << chunkHeader->userPayloadSize() << " but expected " << sizeof(LatestValueData<T>)
+                        << "! The chunk is discarded.");
+            port().releaseChunk(chunkHeader);
+            continue;
+        }
+
+        if (m_chunkHeader != nullptr)
+        {
+            port().releaseChunk(m_chunkHeader);
+        }
+        if (chunkHeader != m_chunkHeader)
+        {
+            m_lastTakenSequenceNumber = LatestValueData<T>::NO_VALUE_SEQUENCE_NUMBER;
+        }
+        m_chunkHeader = chunkHeader;
+        m_data = static_cast<const LatestValueData<T>*>(chunkHeader->userPayload());
+    }
+}
+
+template <typename T, typename BaseSubscriberType>
+inline WaitSetIsConditionSatisfiedCallback
+LatestValueSubscriberImpl<T, BaseSubscriberType>::getCallbackForIsStateConditionSatisfied(
+    const SubscriberState subscriberState) const noexcept
+{
+    switch (subscriberState)
+    {
+    case SubscriberState::HAS_DATA:
+        return WaitSetIsConditionSatisfiedCallback(in_place, *this, &SelfType::hasData);
+    }
+    return nullopt;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
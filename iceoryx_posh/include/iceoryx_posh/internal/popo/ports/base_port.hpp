@@ -79,6 +79,10 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief Notifies the discovery loop of RouDi about a change of the CaPro state of the port; does nothing if the
+    /// port was not created by the PortPool
+    void notifyDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
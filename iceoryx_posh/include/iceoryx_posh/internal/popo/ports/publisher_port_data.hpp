@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
@@ -28,6 +29,7 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iox/atomic.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
 
@@ -54,6 +56,9 @@ struct PublisherPortData : public BasePortData
 
     PublisherOptions m_options;
 
+    /// is only created with PublisherOptions::broadcastRingCapacity and referenced by the ChunkDistributorData
+    optional<BroadcastRingData> m_broadcastRing;
+
     concurrent::Atomic<bool> m_offeringRequested{false};
     concurrent::Atomic<bool> m_offered{false};
 };
@@ -61,6 +61,23 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate multiple chunks with the same settings in one pass, the ownership of the SharedChunks remains in
+    /// the PublisherPortUser for being able to cleanup if the user process disappears
+    /// @param[out] chunkHeaders, array with at least numberOfChunks elements for the pointers to the ChunkHeaders
+    /// @param[in] numberOfChunks, number of chunks to allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return on success all chunks are allocated, on error none of them
+    expected<void, AllocationError> tryAllocateChunks(mepoo::ChunkHeader** const chunkHeaders,
+                                                      const uint32_t numberOfChunks,
+                                                      const uint64_t userPayloadSize,
+                                                      const uint32_t userPayloadAlignment,
+                                                      const uint32_t userHeaderSize = 0U,
+                                                      const uint32_t userHeaderAlignment = 1U) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -69,6 +86,12 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the order of the array to all connected subscriber ports; each
+    /// subscriber is notified only once
+    /// @param[in] chunkHeaders, array with the pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, number of chunks in the array
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -87,6 +110,10 @@ class PublisherPortUser : public BasePort
     /// @return true if there are subscribers otherwise false
     bool hasSubscribers() const noexcept;
 
+    /// @brief Notifies the connected subscribers without sending a chunk, e.g. after the content of an already sent
+    /// chunk was updated in place; does nothing if the publisher port is not offered
+    void notifySubscribers() noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
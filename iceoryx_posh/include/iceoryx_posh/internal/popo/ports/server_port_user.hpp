@@ -112,7 +112,17 @@ class ServerPortUser : public BasePort
     /// ServerRequestResult on error
     expected<const RequestHeader*, ServerRequestResult> getRequest() noexcept;
 
-    /// @brief Release a request that was obtained with getRequest
+    /// @brief Tries to get multiple requests from the queue in one pass. The RequestHeaders are provided in the order
+    /// of the queue (FiFo queue)
+    /// @param[out] requestHeaders, array with at least maxNumberOfRequests elements for the pointers to the
+    /// RequestHeaders
+    /// @param[in] maxNumberOfRequests, the maximum number of requests to get
+    /// @return expected that has the number of new requests if there are new requests in the underlying queue,
+    /// ServerRequestResult on error
+    expected<uint32_t, ServerRequestResult> getRequests(const RequestHeader** const requestHeaders,
+                                                        const uint32_t maxNumberOfRequests) noexcept;
+
+    /// @brief Release a request that was obtained with getRequest or getRequests
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
 
@@ -67,7 +67,16 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
-    /// @brief Release a chunk that was obtained with tryGetChunk
+    /// @brief Tries to get multiple chunks from the queue in one pass. The ChunkHeaders are provided in the order of
+    /// the queue (FiFo queue)
+    /// @param[out] chunkHeaders, array with at least maxNumberOfChunks elements for the pointers to the ChunkHeaders
+    /// @param[in] maxNumberOfChunks, the maximum number of chunks to get
+    /// @return number of new chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<uint32_t, ChunkReceiveResult> tryGetChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                                        const uint32_t maxNumberOfChunks) noexcept;
+
+    /// @brief Release a chunk that was obtained with tryGetChunk or tryGetChunks
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 #include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -37,6 +38,8 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
 
   public:
+    using SampleBatch_t = vector<Sample<T, H>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     explicit PublisherImpl(const capro::ServiceDescription& service,
                            const PublisherOptions& publisherOptions = PublisherOptions());
 
@@ -57,12 +60,29 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    ///
+    /// @brief loanBatch Get multiple samples from loaned shared memory in one pass and default construct the data.
+    /// @param numberOfSamples The number of samples to loan; must not exceed
+    ///        MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY.
+    /// @return The samples that reside in shared memory or an error if not all samples could be loaned; none of the
+    /// samples is loaned in this case.
+    /// @details The loaned samples are automatically released when they go out of scope.
+    ///
+    expected<SampleBatch_t, AllocationError> loanBatch(const uint32_t numberOfSamples) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in their order and then releases their loans. Each subscriber
+    /// is notified only once.
+    /// @param samples The samples to publish.
+    ///
+    void publishBatch(SampleBatch_t&& samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -98,6 +98,49 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline expected<typename PublisherImpl<T, H, BasePublisherType>::SampleBatch_t, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::loanBatch(const uint32_t numberOfSamples) noexcept
+{
+    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+
+    if (numberOfSamples > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    auto result = port().tryAllocateChunks(
+        &chunkHeaders[0], numberOfSamples, sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    SampleBatch_t samples;
+    for (uint32_t i = 0U; i < numberOfSamples; ++i)
+    {
+        samples.emplace_back(convertChunkHeaderToSample(chunkHeaders[i]));
+        new (samples.back().get()) T();
+    }
+    return ok(std::move(samples));
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(SampleBatch_t&& samples) noexcept
+{
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    uint32_t numberOfChunks{0U};
+    for (auto& sample : samples)
+    {
+        // release the Samples ownership of the chunk before publishing
+        chunkHeaders[numberOfChunks] = mepoo::ChunkHeader::fromUserPayload(sample.release());
+        ++numberOfChunks;
+    }
+    samples.clear();
+    port().sendChunks(&chunkHeaders[0], numberOfChunks);
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
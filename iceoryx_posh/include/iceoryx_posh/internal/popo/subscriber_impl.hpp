@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -36,6 +37,8 @@ class SubscriberImpl : public BaseSubscriberType
     using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
 
   public:
+    using SampleBatch_t = vector<Sample<const T, const H>, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+
     explicit SubscriberImpl(const capro::ServiceDescription& service,
                             const SubscriberOptions& subscriberOptions = SubscriberOptions()) noexcept;
 
@@ -54,11 +57,25 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple samples from the top of the receive queue in one pass.
+    /// @param maxNumberOfSamples The maximum number of samples to take; values above
+    ///        MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY are limited to it.
+    /// @return Either the samples in the order of the receive queue or a ChunkReceiveResult. Fewer samples than
+    ///         requested are returned if the queue holds fewer samples or if the subscriber cannot hold more samples
+    ///         in parallel.
+    /// @details Like with take, the samples take care of the cleanup.
+    ///
+    expected<SampleBatch_t, ChunkReceiveResult> takeBatch(const uint32_t maxNumberOfSamples) noexcept;
+
   protected:
     using PortType = typename BaseSubscriberType::PortType;
     using BaseSubscriberType::port;
 
     SubscriberImpl(PortType&& port) noexcept;
+
+  private:
+    Sample<const T, const H> convertChunkHeaderToSample(const mepoo::ChunkHeader* const header) noexcept;
 };
 
 } // namespace popo
@@ -45,12 +45,39 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     {
         return err(result.error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
+    return ok(convertChunkHeaderToSample(result.value()));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline expected<typename SubscriberImpl<T, H, BaseSubscriberType>::SampleBatch_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBatch(const uint32_t maxNumberOfSamples) noexcept
+{
+    const mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    auto result = BaseSubscriberType::takeChunks(
+        &chunkHeaders[0], algorithm::minVal(maxNumberOfSamples, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    SampleBatch_t samples;
+    for (uint32_t i = 0U; i < result.value(); ++i)
+    {
+        samples.emplace_back(convertChunkHeaderToSample(chunkHeaders[i]));
+    }
+    return ok(std::move(samples));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline Sample<const T, const H>
+SubscriberImpl<T, H, BaseSubscriberType>::convertChunkHeaderToSample(const mepoo::ChunkHeader* const header) noexcept
+{
+    auto userPayloadPtr = static_cast<const T*>(header->userPayload());
     auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
+    return Sample<const T, const H>(std::move(samplePtr));
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
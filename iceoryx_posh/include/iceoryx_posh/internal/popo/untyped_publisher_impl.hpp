@@ -55,6 +55,23 @@ class UntypedPublisherImpl : public BasePublisherType
          const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
          const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
 
+    ///
+    /// @brief Get multiple chunks with the same size from loaned shared memory in one pass.
+    /// @param userPayloads Array with at least numberOfChunks elements for the pointers to the user-payloads.
+    /// @param numberOfChunks The number of chunks to loan; must not exceed
+    ///        MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY.
+    /// @param usePayloadSize The expected user-payload size of the chunks.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunks.
+    /// @return An AllocationError if not all chunks could be loaned; none of the chunks is loaned in this case.
+    ///
+    expected<void, AllocationError>
+    loanBatch(void** const userPayloads,
+              const uint32_t numberOfChunks,
+              const uint64_t userPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+              const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+              const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
     ///
     /// @brief Publish the provided memory chunk.
     /// @param userPayload Pointer to the user-payload of the allocated shared memory chunk.
@@ -62,6 +79,13 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in the order of the array. Each subscriber is notified only once.
+    /// @param userPayloads Array with the pointers to the user-payloads of the allocated shared memory chunks.
+    /// @param numberOfChunks The number of chunks in the array.
+    ///
+    void publishBatch(void* const* const userPayloads, const uint32_t numberOfChunks) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
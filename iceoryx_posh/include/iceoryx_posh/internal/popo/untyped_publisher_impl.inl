@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/untyped_publisher_impl.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
@@ -44,6 +46,22 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(void* const* const userPayloads,
+                                                                  const uint32_t numberOfChunks) noexcept
+{
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    for (uint32_t offset = 0U; offset < numberOfChunks; offset += MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        const auto sliceSize = std::min(numberOfChunks - offset, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY);
+        for (uint32_t i = 0U; i < sliceSize; ++i)
+        {
+            chunkHeaders[i] = mepoo::ChunkHeader::fromUserPayload(userPayloads[offset + i]);
+        }
+        port().sendChunks(&chunkHeaders[0], sliceSize);
+    }
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
@@ -62,6 +80,36 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+inline expected<void, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanBatch(void** const userPayloads,
+                                                   const uint32_t numberOfChunks,
+                                                   const uint64_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment) noexcept
+{
+    if (numberOfChunks > MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    return port()
+        .tryAllocateChunks(&chunkHeaders[0],
+                           numberOfChunks,
+                           userPayloadSize,
+                           userPayloadAlignment,
+                           userHeaderSize,
+                           userHeaderAlignment)
+        .and_then([&] {
+            for (uint32_t i = 0U; i < numberOfChunks; ++i)
+            {
+                userPayloads[i] = chunkHeaders[i]->userPayload();
+            }
+        });
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
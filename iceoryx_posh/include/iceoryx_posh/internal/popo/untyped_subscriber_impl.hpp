@@ -57,6 +57,19 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple chunks from the top of the receive queue in one pass.
+    /// @param userPayloads Array with at least maxNumberOfChunks elements for the user-payload pointers of the chunks
+    ///        taken; the chunks are stored in the order of the receive queue.
+    /// @param maxNumberOfChunks The maximum number of chunks to take; values above
+    ///        MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY are limited to it.
+    /// @return The number of chunks taken.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling 'release' for each chunk
+    ///
+    expected<uint32_t, ChunkReceiveResult> takeChunks(const void** const userPayloads,
+                                                      const uint32_t maxNumberOfChunks) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
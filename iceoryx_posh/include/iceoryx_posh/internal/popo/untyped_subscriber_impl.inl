@@ -48,6 +48,26 @@ inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubsc
     return ok(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+inline expected<uint32_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeChunks(const void** const userPayloads,
+                                                      const uint32_t maxNumberOfChunks) noexcept
+{
+    const mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    auto result = BaseSubscriber::takeChunks(
+        &chunkHeaders[0], algorithm::minVal(maxNumberOfChunks, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (uint32_t i = 0U; i < result.value(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    return ok(result.value());
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
@@ -28,6 +28,20 @@ namespace iox
 {
 namespace popo
 {
+namespace detail
+{
+/// @brief the smallest power of two which is at least twice the capacity of the UsedChunkList
+constexpr uint32_t usedChunkListLookupCapacity(const uint32_t capacity) noexcept
+{
+    uint32_t lookupCapacity{1U};
+    while (lookupCapacity < 2U * capacity)
+    {
+        lookupCapacity <<= 1U;
+    }
+    return lookupCapacity;
+}
+} // namespace detail
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +52,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The runtime finds the entry of a chunk which shall be removed via a lookup table with open addressing,
+///        which is keyed by the ChunkHeader address. This table is only used by the runtime and rebuilt by init,
+///        therefore RouDi does not depend on its consistency.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -53,6 +70,18 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Inserts multiple SharedChunks into the list; either all or none of the chunks are inserted
+    /// @param[in] chunks is an array with the chunks to store in the list
+    /// @param[in] numberOfChunks is the number of chunks in the array
+    /// @return true if successful, otherwise false if the list has not enough space left for all chunks
+    /// @note only from runtime context
+    bool insert(const mepoo::SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Returns the number of chunks which can still be inserted into the list
+    /// @return the number of free entries
+    /// @note only from runtime context
+    uint32_t numberOfFreeEntries() const noexcept;
+
     /// @brief Removes a chunk from the list
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
@@ -67,18 +96,25 @@ class UsedChunkList
 
   private:
     void init() noexcept;
+    void insertIntoFreeEntry(const mepoo::SharedChunk& chunk) noexcept;
+
+    static uint32_t lookupStartPosition(const mepoo::ChunkHeader* const chunkHeader) noexcept;
+    void removeFromLookup(const uint32_t lookupPosition) noexcept;
 
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @brief the lookup table is at least twice as large as the list in order to keep the probe sequences short
+    static constexpr uint32_t LOOKUP_CAPACITY{detail::usedChunkListLookupCapacity(Capacity)};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     concurrent::AtomicFlag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_numberOfFreeEntries{Capacity};
     uint32_t m_listIndices[Capacity];
+    uint32_t m_lookup[LOOKUP_CAPACITY];
     DataElement_t m_listData[Capacity];
 };
 
@@ -31,6 +31,7 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
     static_assert(sizeof(DataElement_t) <= 8U, "The size of the data element type must not exceed 64 bit!");
     static_assert(std::is_trivially_copyable<DataElement_t>::value,
                   "The data element type must be trivially copyable!");
+    static_assert(LOOKUP_CAPACITY >= 2U * Capacity, "The lookup table must be at least twice as large as the list!");
 
     init();
 }
@@ -41,17 +42,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        insertIntoFreeEntry(chunk);
 
         m_synchronizer.clear(std::memory_order_release);
         return true;
@@ -63,43 +54,110 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+bool UsedChunkList<Capacity>::insert(const mepoo::SharedChunk* const chunks, const uint32_t numberOfChunks) noexcept
+{
+    // check the free space in advance in order to insert either all or none of the chunks
+    if (numberOfChunks > m_numberOfFreeEntries)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        insertIntoFreeEntry(chunks[i]);
+    }
+
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertIntoFreeEntry(const mepoo::SharedChunk& chunk) noexcept
+{
+    // take the entry from the head of the free list
+    auto index = m_freeListHead;
+    m_freeListHead = m_listIndices[index];
+    m_listIndices[index] = INVALID_INDEX;
+
+    m_listData[index] = DataElement_t(chunk);
+
+    // the first empty position of the probe sequence refers to the entry
+    auto lookupPosition = lookupStartPosition(chunk.getChunkHeader());
+    while (m_lookup[lookupPosition] != INVALID_INDEX)
+    {
+        lookupPosition = (lookupPosition + 1U) & (LOOKUP_CAPACITY - 1U);
+    }
+    m_lookup[lookupPosition] = index;
+
+    --m_numberOfFreeEntries;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::numberOfFreeEntries() const noexcept
 {
-    auto previous = INVALID_INDEX;
+    return m_numberOfFreeEntries;
+}
 
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+{
+    // follow the probe sequence of the chunkHeader until an empty position is reached
+    for (auto lookupPosition = lookupStartPosition(chunkHeader); m_lookup[lookupPosition] != INVALID_INDEX;
+         lookupPosition = (lookupPosition + 1U) & (LOOKUP_CAPACITY - 1U))
     {
-        if (!m_listData[current].isLogicalNullptr())
+        const auto index = m_lookup[lookupPosition];
+        // does the entry match the one we want to remove?
+        if (m_listData[index].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[index].releaseToSharedChunk();
+
+            removeFromLookup(lookupPosition);
+
+            // insert index to free list
+            m_listIndices[index] = m_freeListHead;
+            m_freeListHead = index;
+            ++m_numberOfFreeEntries;
+
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::lookupStartPosition(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    // Fibonacci hashing of the address; the lower bits are always the same due to the alignment of the ChunkHeader
+    constexpr uint64_t FIBONACCI_HASH_MULTIPLIER{0x9E3779B97F4A7C15ULL};
+    constexpr uint64_t ALIGNMENT_BITS{3U};
+    const auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(chunkHeader)) >> ALIGNMENT_BITS;
+    return static_cast<uint32_t>((key * FIBONACCI_HASH_MULTIPLIER) >> 32U) & (LOOKUP_CAPACITY - 1U);
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromLookup(const uint32_t lookupPosition) noexcept
+{
+    constexpr uint32_t POSITION_MASK{LOOKUP_CAPACITY - 1U};
+
+    // the following positions of the probe sequence are shifted back into the gap, unless the gap is before the start
+    // position of their chunk, in order to keep all entries reachable without tombstones
+    auto gap = lookupPosition;
+    for (auto position = (gap + 1U) & POSITION_MASK; m_lookup[position] != INVALID_INDEX;
+         position = (position + 1U) & POSITION_MASK)
+    {
+        const auto startPosition = lookupStartPosition(m_listData[m_lookup[position]].getChunkHeader());
+        const auto distanceFromStart = (position - startPosition) & POSITION_MASK;
+        const auto distanceFromGap = (position - gap) & POSITION_MASK;
+        if (distanceFromStart >= distanceFromGap)
+        {
+            m_lookup[gap] = m_lookup[position];
+            gap = position;
+        }
+    }
+    m_lookup[gap] = INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -136,8 +194,13 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
+    for (auto& index : m_lookup)
+    {
+        index = INVALID_INDEX;
+    }
+
     m_freeListHead = 0U;
+    m_numberOfFreeEntries = Capacity;
 
     // clear data
     for (auto& data : m_listData)
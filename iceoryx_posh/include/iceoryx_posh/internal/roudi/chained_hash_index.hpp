@@ -0,0 +1,111 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_CHAINED_HASH_INDEX_HPP
+#define IOX_POSH_ROUDI_CHAINED_HASH_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iox/function_ref.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief the smallest power of two which is at least twice the capacity
+constexpr uint32_t chainedHashIndexLookupCapacity(const uint32_t capacity) noexcept
+{
+    uint32_t lookupCapacity{1U};
+    while (lookupCapacity < 2U * capacity)
+    {
+        lookupCapacity <<= 1U;
+    }
+    return lookupCapacity;
+}
+} // namespace detail
+
+namespace roudi
+{
+/// @brief FNV-1a hash of an ID string
+inline uint32_t idStringHash(const capro::IdString_t& id) noexcept;
+
+/// @brief Hash of the service, instance and event ID of a service description
+inline uint32_t serviceDescriptionHash(const uint32_t serviceHash,
+                                       const uint32_t instanceHash,
+                                       const uint32_t eventHash) noexcept;
+inline uint32_t serviceDescriptionHash(const capro::ServiceDescription& serviceDescription) noexcept;
+
+/// @brief Index over the entries of a container with 'Capacity' slots which have the same key, e.g. the same service
+/// ID. The entries with the same key are chained in a doubly linked list in the order of insertion and the head of
+/// each chain is found via a hash table with open addressing and linear probing. The keys are not stored but compared
+/// via a callable with the entries in the container. Since only indices are stored, the index can be copied together
+/// with its container, e.g. into shared memory.
+template <uint32_t Capacity>
+class ChainedHashIndex
+{
+  public:
+    static constexpr uint32_t NO_INDEX{Capacity};
+
+    struct Chain
+    {
+        uint32_t head{NO_INDEX};
+        uint32_t length{0U};
+    };
+
+    ChainedHashIndex() noexcept;
+
+    /// @brief Finds the chain of the entries with a key
+    /// @param[in] hash of the key
+    /// @param[in] hasKey returns true if the entry with the given index has the key
+    /// @return the chain of the entries, the head is NO_INDEX if there is no entry with the key
+    Chain find(const uint32_t hash, const function_ref<bool(uint32_t)> hasKey) const noexcept;
+
+    /// @return the index of the next entry in the chain or NO_INDEX
+    uint32_t next(const uint32_t index) const noexcept;
+
+    /// @brief Appends an entry to the chain of the entries with the same key
+    /// @param[in] index of the entry
+    /// @param[in] hash of the key of the entry
+    /// @param[in] hasKey returns true if the entry with the given index has the same key
+    void insert(const uint32_t index, const uint32_t hash, const function_ref<bool(uint32_t)> hasKey) noexcept;
+
+    /// @brief Removes an entry from its chain; must be called before the key of the entry becomes invalid
+    /// @param[in] index of the entry
+    /// @param[in] hasKey returns true if the entry with the given index has the same key
+    void remove(const uint32_t index, const function_ref<bool(uint32_t)> hasKey) noexcept;
+
+  private:
+    /// @brief the hash table is at least twice as large as the container in order to keep the probe sequences short
+    static constexpr uint32_t LOOKUP_CAPACITY{detail::chainedHashIndexLookupCapacity(Capacity)};
+
+    uint32_t findPosition(const uint32_t hash, const function_ref<bool(uint32_t)> hasKey) const noexcept;
+    static uint32_t startPosition(const uint32_t hash) noexcept;
+
+    uint32_t m_heads[LOOKUP_CAPACITY];
+    uint32_t m_hashes[Capacity]{};
+    uint32_t m_next[Capacity]{};
+    uint32_t m_previous[Capacity]{};
+    // tail and length are only maintained for the head of a chain
+    uint32_t m_tails[Capacity]{};
+    uint32_t m_lengths[Capacity]{};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/chained_hash_index.inl"
+
+#endif // IOX_POSH_ROUDI_CHAINED_HASH_INDEX_HPP
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_CHAINED_HASH_INDEX_INL
+#define IOX_POSH_ROUDI_CHAINED_HASH_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/chained_hash_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+inline uint32_t idStringHash(const capro::IdString_t& id) noexcept
+{
+    constexpr uint32_t FNV_OFFSET_BASIS{2166136261U};
+    constexpr uint32_t FNV_PRIME{16777619U};
+
+    uint32_t hash{FNV_OFFSET_BASIS};
+    const auto* const characters = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        hash = (hash ^ static_cast<uint8_t>(characters[i])) * FNV_PRIME;
+    }
+    return hash;
+}
+
+inline uint32_t
+serviceDescriptionHash(const uint32_t serviceHash, const uint32_t instanceHash, const uint32_t eventHash) noexcept
+{
+    constexpr uint32_t GOLDEN_RATIO{0x9E3779B9U};
+
+    uint32_t hash{serviceHash};
+    hash ^= instanceHash + GOLDEN_RATIO + (hash << 6U) + (hash >> 2U);
+    hash ^= eventHash + GOLDEN_RATIO + (hash << 6U) + (hash >> 2U);
+    return hash;
+}
+
+inline uint32_t serviceDescriptionHash(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return serviceDescriptionHash(idStringHash(serviceDescription.getServiceIDString()),
+                                  idStringHash(serviceDescription.getInstanceIDString()),
+                                  idStringHash(serviceDescription.getEventIDString()));
+}
+
+template <uint32_t Capacity>
+inline ChainedHashIndex<Capacity>::ChainedHashIndex() noexcept
+{
+    for (auto& head : m_heads)
+    {
+        head = NO_INDEX;
+    }
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChainedHashIndex<Capacity>::startPosition(const uint32_t hash) noexcept
+{
+    // Fibonacci hashing in order to spread similar hashes over the table
+    constexpr uint64_t FIBONACCI_HASH_MULTIPLIER{0x9E3779B97F4A7C15ULL};
+    return static_cast<uint32_t>((static_cast<uint64_t>(hash) * FIBONACCI_HASH_MULTIPLIER) >> 32U)
+           & (LOOKUP_CAPACITY - 1U);
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChainedHashIndex<Capacity>::findPosition(const uint32_t hash,
+                                                         const function_ref<bool(uint32_t)> hasKey) const noexcept
+{
+    // returns either the position of the chain with the key or the empty position which terminates the probe sequence
+    auto position = startPosition(hash);
+    while (m_heads[position] != NO_INDEX)
+    {
+        const auto head = m_heads[position];
+        if (m_hashes[head] == hash && hasKey(head))
+        {
+            break;
+        }
+        position = (position + 1U) & (LOOKUP_CAPACITY - 1U);
+    }
+    return position;
+}
+
+template <uint32_t Capacity>
+inline typename ChainedHashIndex<Capacity>::Chain
+ChainedHashIndex<Capacity>::find(const uint32_t hash, const function_ref<bool(uint32_t)> hasKey) const noexcept
+{
+    const auto head = m_heads[findPosition(hash, hasKey)];
+    if (head == NO_INDEX)
+    {
+        return Chain{};
+    }
+    return Chain{head, m_lengths[head]};
+}
+
+template <uint32_t Capacity>
+inline uint32_t ChainedHashIndex<Capacity>::next(const uint32_t index) const noexcept
+{
+    return m_next[index];
+}
+
+template <uint32_t Capacity>
+inline void ChainedHashIndex<Capacity>::insert(const uint32_t index,
+                                               const uint32_t hash,
+                                               const function_ref<bool(uint32_t)> hasKey) noexcept
+{
+    m_hashes[index] = hash;
+    m_next[index] = NO_INDEX;
+
+    const auto position = findPosition(hash, hasKey);
+    const auto head = m_heads[position];
+    if (head == NO_INDEX)
+    {
+        m_heads[position] = index;
+        m_previous[index] = NO_INDEX;
+        m_tails[index] = index;
+        m_lengths[index] = 1U;
+        return;
+    }
+
+    const auto tail = m_tails[head];
+    m_next[tail] = index;
+    m_previous[index] = tail;
+    m_tails[head] = index;
+    ++m_lengths[head];
+}
+
+template <uint32_t Capacity>
+inline void ChainedHashIndex<Capacity>::remove(const uint32_t index,
+                                               const function_ref<bool(uint32_t)> hasKey) noexcept
+{
+    const auto position = findPosition(m_hashes[index], hasKey);
+    const auto head = m_heads[position];
+    const auto next = m_next[index];
+
+    if (head != index)
+    {
+        const auto previous = m_previous[index];
+        m_next[previous] = next;
+        if (next != NO_INDEX)
+        {
+            m_previous[next] = previous;
+        }
+        else
+        {
+            m_tails[head] = previous;
+        }
+        --m_lengths[head];
+        return;
+    }
+
+    if (next != NO_INDEX)
+    {
+        // the next entry becomes the head of the chain
+        m_heads[position] = next;
+        m_previous[next] = NO_INDEX;
+        m_tails[next] = m_tails[index];
+        m_lengths[next] = m_lengths[index] - 1U;
+        return;
+    }
+
+    // the chain is empty; the following positions of the probe sequence are shifted back into the gap, unless the gap
+    // is before the start position of their chain, in order to keep all chains reachable without tombstones
+    constexpr uint32_t POSITION_MASK{LOOKUP_CAPACITY - 1U};
+    auto gap = position;
+    for (auto current = (gap + 1U) & POSITION_MASK; m_heads[current] != NO_INDEX;
+         current = (current + 1U) & POSITION_MASK)
+    {
+        const auto distanceFromStart = (current - startPosition(m_hashes[m_heads[current]])) & POSITION_MASK;
+        const auto distanceFromGap = (current - gap) & POSITION_MASK;
+        if (distanceFromStart >= distanceFromGap)
+        {
+            m_heads[gap] = m_heads[current];
+            gap = current;
+        }
+    }
+    m_heads[gap] = NO_INDEX;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_CHAINED_HASH_INDEX_INL
@@ -80,6 +80,8 @@ class MemPoolIntrospection
     static void prepareIntrospectionSample(MemPoolIntrospectionInfo& sample,
                                            const PosixGroup& readerGroup,
                                            const PosixGroup& writerGroup,
+                                           const uint64_t pageSize,
+                                           const optional<uint32_t> numaNode,
                                            uint32_t id) noexcept;
 
     /// @brief copy data fro internal struct into interface struct
@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_MEMPOOL_INTROSPECTION_INL
 
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/thread.hpp"
 #include "mempool_introspection.hpp"
 
@@ -71,12 +72,16 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
     MemPoolIntrospectionInfo& sample,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
+    const uint64_t pageSize,
+    const optional<uint32_t> numaNode,
     uint32_t id) noexcept
 {
     sample.m_readerGroupName.assign("");
     sample.m_readerGroupName.append(TruncateToCapacity, readerGroup.getName());
     sample.m_writerGroupName.assign("");
     sample.m_writerGroupName.append(TruncateToCapacity, writerGroup.getName());
+    sample.m_pageSize = pageSize;
+    sample.m_numaNode = numaNode;
     sample.m_id = id;
 }
 
@@ -108,6 +113,8 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
             prepareIntrospectionSample(memPoolIntrospectionInfo,
                                        PosixGroup::getGroupOfCurrentProcess(),
                                        PosixGroup::getGroupOfCurrentProcess(),
+                                       detail::pageSize(),
+                                       nullopt,
                                        id);
             copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
             ++id;
@@ -118,8 +125,12 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                 if (sample->emplace_back())
                 {
                     auto& memPoolIntrospectionInfo = sample->back();
-                    prepareIntrospectionSample(
-                        memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
+                    prepareIntrospectionSample(memPoolIntrospectionInfo,
+                                               segment.getReaderGroup(),
+                                               segment.getWriterGroup(),
+                                               segment.getPageSize(),
+                                               segment.getNumaNode(),
+                                               id);
                     copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
                 }
                 else
@@ -164,6 +175,8 @@ MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolI
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - sizeof(mepoo::ChunkHeader);
+        dst.m_numaNode = src.m_numaNode;
+        dst.m_leakedChunks = src.m_leakedChunks;
     }
 }
 
@@ -54,6 +54,10 @@ class MemPoolSegmentManagerMemoryBlock : public MemoryBlock
     /// @return an optional pointer to the underlying type, nullopt_t if value is not initialized
     optional<mepoo::SegmentManager<>*> segmentManager() const noexcept;
 
+    /// @copydoc MemoryBlock::forEachAdditionalMemory
+    /// @note This provides the memory of the shared memory segments of the SegmentManager
+    void forEachAdditionalMemory(const function_ref<void(void*, uint64_t)> callable) const noexcept override;
+
   protected:
     /// @copydoc MemoryBlock::onMemoryAvailable
     /// @note This will create the SegmentManager at the location 'memory' points to
@@ -31,6 +31,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/internal/roudi/chained_hash_index.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
@@ -38,6 +39,7 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/optional.hpp"
 #include "iox/posix_shared_memory_object.hpp"
 #include "iox/type_traits.hpp"
@@ -194,6 +196,35 @@ class PortManager
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
+    template <typename PortContainer>
+    static typename PortContainer::ValueType& portAt(PortContainer& ports, const uint32_t index) noexcept;
+
+    template <typename PortContainer, uint32_t Capacity>
+    void addToPortIndex(PortContainer& ports,
+                        ChainedHashIndex<Capacity>& portIndex,
+                        const typename PortContainer::ValueType* const portData) noexcept;
+
+    template <typename PortContainer, uint32_t Capacity>
+    void removeFromPortIndex(PortContainer& ports,
+                             ChainedHashIndex<Capacity>& portIndex,
+                             const typename PortContainer::ValueType* const portData) noexcept;
+
+    /// @brief Calls the callable with each port data of the container which has the service description
+    /// @note the callable is allowed to destroy the port it is called with
+    template <typename PortContainer, uint32_t Capacity, typename Callable>
+    void forEachPortWithService(PortContainer& ports,
+                                const ChainedHashIndex<Capacity>& portIndex,
+                                const capro::ServiceDescription& service,
+                                const Callable& callable) noexcept;
+
+    /// @brief Calls the callable with an iterator to each port of the container which notified a change since the
+    /// last discovery run
+    /// @param[in] ports is the container of the port pool
+    /// @param[in] offset is the offset of the port type in the DiscoveryNotificationData
+    /// @note the callable is allowed to destroy the port it is called with
+    template <typename PortContainer, typename Callable>
+    void forEachChangedPort(PortContainer& ports, const uint64_t offset, const Callable& callable) noexcept;
+
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
@@ -202,6 +233,16 @@ class PortManager
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
 
+    // the ports with the same service description are chained so that the discovery visits only matching ports
+    ChainedHashIndex<MAX_PUBLISHERS> m_publisherPortIndex;
+    ChainedHashIndex<MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    ChainedHashIndex<MAX_SERVERS> m_serverPortIndex;
+    ChainedHashIndex<MAX_CLIENTS> m_clientPortIndex;
+
+    // the ports which notified a change since the last discovery run; taken from the DiscoveryNotificationData at the
+    // beginning of each run so that a notification during the run is handled in the next run
+    uint64_t m_changedPorts[popo::DiscoveryNotificationData::NUMBER_OF_WORDS]{};
+
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
@@ -28,28 +28,18 @@ inline optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept
 {
     // check if the publisher is already in the list
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto port = publisherPorts.begin();
-    while (port != publisherPorts.end())
-    {
-        popo::PublisherPortRouDi publisherPort(port.to_ptr());
-
-        if (service == publisherPort.getCaProServiceDescription())
-        {
+    optional<RuntimeName_t> usedByProcess;
+    forEachPortWithService(
+        m_portPool->getPublisherPortDataList(), m_publisherPortIndex, service, [&](auto& publisherPortData) {
+            popo::PublisherPortRouDi publisherPort(&publisherPortData);
             if (publisherPort.toBeDestroyed())
             {
-                destroyPublisherPort(port.to_ptr());
-                port = publisherPorts.begin();
-                continue;
+                destroyPublisherPort(&publisherPortData);
+                return;
             }
-            return make_optional<RuntimeName_t>(port->m_runtimeName);
-        }
-        else
-        {
-            ++port;
-        }
-    }
-    return nullopt;
+            usedByProcess.emplace(publisherPortData.m_runtimeName);
+        });
+    return usedByProcess;
 }
 
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>*>
@@ -59,6 +49,78 @@ inline optional<RuntimeName_t> PortManager::doesViolateCommunicationPolicy(const
     return nullopt;
 }
 
+template <typename PortContainer>
+inline typename PortContainer::ValueType& PortManager::portAt(PortContainer& ports, const uint32_t index) noexcept
+{
+    return *ports.iter_from_index(static_cast<typename PortContainer::IndexType>(index));
+}
+
+template <typename PortContainer, uint32_t Capacity>
+inline void PortManager::addToPortIndex(PortContainer& ports,
+                                        ChainedHashIndex<Capacity>& portIndex,
+                                        const typename PortContainer::ValueType* const portData) noexcept
+{
+    const auto& service = portData->m_serviceDescription;
+    const auto hasService = [&](const uint32_t index) { return portAt(ports, index).m_serviceDescription == service; };
+    portIndex.insert(ports.iter_from_ptr(portData).to_index(), serviceDescriptionHash(service), hasService);
+}
+
+template <typename PortContainer, uint32_t Capacity>
+inline void PortManager::removeFromPortIndex(PortContainer& ports,
+                                             ChainedHashIndex<Capacity>& portIndex,
+                                             const typename PortContainer::ValueType* const portData) noexcept
+{
+    const auto& service = portData->m_serviceDescription;
+    const auto hasService = [&](const uint32_t index) { return portAt(ports, index).m_serviceDescription == service; };
+    portIndex.remove(ports.iter_from_ptr(portData).to_index(), hasService);
+}
+
+template <typename PortContainer, uint32_t Capacity, typename Callable>
+inline void PortManager::forEachPortWithService(PortContainer& ports,
+                                                const ChainedHashIndex<Capacity>& portIndex,
+                                                const capro::ServiceDescription& service,
+                                                const Callable& callable) noexcept
+{
+    const auto hasService = [&](const uint32_t index) { return portAt(ports, index).m_serviceDescription == service; };
+    auto current = portIndex.find(serviceDescriptionHash(service), hasService).head;
+    while (current != ChainedHashIndex<Capacity>::NO_INDEX)
+    {
+        // the next port is determined upfront since the callable might destroy the current one
+        auto& portData = portAt(ports, current);
+        current = portIndex.next(current);
+        callable(portData);
+    }
+}
+
+template <typename PortContainer, typename Callable>
+inline void
+PortManager::forEachChangedPort(PortContainer& ports, const uint64_t offset, const Callable& callable) noexcept
+{
+    constexpr uint64_t PORTS_PER_WORD{popo::DiscoveryNotificationData::PORTS_PER_WORD};
+    const uint64_t endIndex{offset + ports.capacity()};
+    for (uint64_t wordIndex = offset / PORTS_PER_WORD; wordIndex * PORTS_PER_WORD < endIndex; ++wordIndex)
+    {
+        auto changedBits = m_changedPorts[wordIndex];
+        while (changedBits != 0U)
+        {
+            const uint64_t index{wordIndex * PORTS_PER_WORD + countTrailingZeros(changedBits)};
+            changedBits &= changedBits - 1U;
+            if (index < offset || index >= endIndex)
+            {
+                // the bits of the neighbouring port types share the word
+                continue;
+            }
+
+            // the port might have been destroyed after its notification
+            auto port = ports.iter_from_index(static_cast<typename PortContainer::IndexType>(index - offset));
+            if (port != ports.end())
+            {
+                callable(port);
+            }
+        }
+    }
+}
+
 } // namespace roudi
 } // namespace iox
 
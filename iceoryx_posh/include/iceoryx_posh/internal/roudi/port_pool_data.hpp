@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
@@ -57,6 +58,8 @@ struct PortPoolData
     using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
     ClientContainer m_clientPortMembers;
 
+    popo::DiscoveryNotificationData m_discoveryNotificationData;
+
     const roudi::UniqueRouDiId m_uniqueRouDiId;
 };
 
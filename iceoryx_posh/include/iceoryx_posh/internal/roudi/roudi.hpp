@@ -19,10 +19,10 @@
 
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
@@ -108,7 +108,9 @@ class RouDi
     concurrent::Atomic<bool> m_runMonitoringAndDiscoveryThread;
     concurrent::Atomic<bool> m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
+    /// @brief the ports wake up the discovery loop via this data when their CaPro state changes; RouDi itself uses
+    /// it to trigger the discovery loop manually and on shutdown
+    popo::DiscoveryNotificationData* m_discoveryNotificationData{nullptr};
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/chained_hash_index.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
@@ -108,19 +109,32 @@ class ServiceRegistry
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    /// the entries are indexed by their service description and by each of their IDs in order to look them up
+    /// without iterating over all entries
+    using Index_t = ChainedHashIndex<CAPACITY>;
+    Index_t m_serviceDescriptionIndex;
+    Index_t m_serviceIndex;
+    Index_t m_instanceIndex;
+    Index_t m_eventIndex;
+
+    // stack of the free slots in 'm_serviceDescriptions' which were occupied by previously removed entries
+    uint32_t m_freeIndices[CAPACITY]{};
+    uint32_t m_numberOfFreeIndices{0U};
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
+    uint32_t findIndex(const capro::IdString_t& service,
+                       const capro::IdString_t& instance,
+                       const capro::IdString_t& event) const noexcept;
 
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    void addToIndices(const uint32_t index) noexcept;
+    void removeEntry(const uint32_t index) noexcept;
 };
 
 } // namespace roudi
@@ -51,12 +51,15 @@ class SharedMemoryUser
     /// @param[in] managementShmSize size of the shared memory management segment
     /// @param[in] segmentManagerAddressOffset adress of the segment manager that does the final mapping of memory in
     /// the process
+    /// @param[in] prefaultMemory if true, all pages of the shared memory are faulted in after the mapping in order to
+    /// prevent the page faults on the first access
     /// @return a 'SharedMemoryUser' instance or an 'SharedMemoryUserError' on failure
     static expected<SharedMemoryUser, SharedMemoryUserError>
     create(const DomainId domainId,
            const uint64_t segmentId,
            const uint64_t managementShmSize,
-           const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+           const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+           const bool prefaultMemory = false) noexcept;
 
     ~SharedMemoryUser() noexcept;
 
@@ -77,7 +80,9 @@ class SharedMemoryUser
                                                                 const ResourceType resourceType,
                                                                 const ShmName_t& shmName,
                                                                 const uint64_t shmSize,
-                                                                const AccessMode accessMode) noexcept;
+                                                                const AccessMode accessMode,
+                                                                const optional<Path>& mountPoint,
+                                                                const bool prefaultMemory) noexcept;
 
 
   private:
@@ -0,0 +1,48 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
+#define IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
+
+#include "iox/optional.hpp"
+#include "iox/path.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Configures the huge pages which back a payload segment. If the huge pages cannot be used, e.g. since
+///        not enough huge pages are reserved, the segment falls back to regular pages.
+struct HugePageConfig
+{
+    /// @brief the size of the huge pages, e.g. 2 MiB or 1 GiB; a value of 0 disables huge pages
+    uint64_t m_pageSize{0U};
+
+    /// @brief the mount point of a hugetlbfs with pages of 'm_pageSize', e.g. '/dev/hugepages'
+    optional<Path> m_mountPoint;
+
+    /// @brief returns true if huge pages are requested
+    bool isEnabled() const noexcept
+    {
+        return m_pageSize != 0U;
+    }
+};
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_HUGE_PAGE_CONFIG_HPP
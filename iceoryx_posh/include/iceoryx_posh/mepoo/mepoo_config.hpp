@@ -17,6 +17,7 @@
 #define IOX_POSH_MEPOO_MEPOO_CONFIG_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -29,24 +30,57 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines how the chunk memory of a segment is organized
+enum class MemPoolType : uint8_t
+{
+    /// @brief one MemPool with fixed size chunks for each entry of the MePooConfig
+    FIXED_SIZE,
+    /// @brief one MemPool for the whole chunk memory which splits and coalesces blocks of power of two multiples of
+    /// the smallest chunk size; the entries of the MePooConfig define the size of the chunk memory, the smallest and
+    /// largest chunk and the number of chunks which can be used at the same time
+    BUDDY
+};
+
 struct MePooConfig
 {
   public:
     struct Entry
     {
-        /// @brief set the size and count of memory chunks
-        Entry(uint64_t size, uint32_t chunkCount) noexcept
+        /// @brief set the size and count of memory chunks and optionally the NUMA node of the chunk memory and the
+        /// number of overflow chunks
+        Entry(uint64_t size,
+              uint32_t chunkCount,
+              optional<uint32_t> numaNode = nullopt,
+              uint32_t overflowChunkCount = 0U) noexcept
             : m_size(size)
             , m_chunkCount(chunkCount)
+            , m_numaNode(numaNode)
+            , m_overflowChunkCount(overflowChunkCount)
         {
         }
         uint64_t m_size{0};
         uint32_t m_chunkCount{0};
+        /// @brief the NUMA node the chunk memory is bound to; if not set, the NUMA node of the segment is used
+        optional<uint32_t> m_numaNode;
+        /// @brief the number of additional chunks which are only used once all regular chunks are in use; the
+        /// physical memory of these chunks is released by RouDi when they are idle again
+        /// @note not supported by the buddy mempool
+        uint32_t m_overflowChunkCount{0};
     };
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief if set, a chunk is obtained from the next larger mempool when the best fitting mempool is out of chunks
+    bool m_fallbackToLargerMemPool{false};
+
+    /// @brief defines whether the chunks are taken from fixed size mempools or from a buddy mempool
+    MemPoolType m_memPoolType{MemPoolType::FIXED_SIZE};
+
+    /// @brief if set, the ChunkManagement with the reference counter of a chunk is placed in reserved space at the
+    /// start of the chunk instead of being obtained from the separate chunk management pool
+    bool m_embedChunkManagement{false};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
 
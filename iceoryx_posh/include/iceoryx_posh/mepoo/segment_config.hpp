@@ -16,6 +16,7 @@
 #ifndef IOX_POSH_MEPOO_SEGMENT_CONFIG_HPP
 #define IOX_POSH_MEPOO_SEGMENT_CONFIG_HPP
 
+#include "iceoryx_posh/mepoo/huge_page_config.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
@@ -47,6 +48,9 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        HugePageConfig m_hugePageConfig;
+        /// @brief the NUMA node the segment memory is bound to; mempools can override it with their own NUMA node
+        optional<uint32_t> m_numaNode;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
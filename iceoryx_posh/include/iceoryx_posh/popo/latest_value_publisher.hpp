@@ -0,0 +1,39 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
+
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValuePublisher class provides state data like a pose, where the subscribers are only interested
+/// in the newest value. The value lives in a single shared memory chunk which is overwritten in place by every update.
+/// @param[in] T user payload type; must be trivially copyable and default constructible
+template <typename T>
+class LatestValuePublisher : public LatestValuePublisherImpl<T>
+{
+  public:
+    using LatestValuePublisherImpl<T>::LatestValuePublisherImpl;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
@@ -0,0 +1,40 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_HPP
+
+#include "iceoryx_posh/internal/popo/latest_value_subscriber_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueSubscriber class reads the newest value of a LatestValuePublisher without queuing. It can be
+/// attached to a WaitSet with SubscriberState::HAS_DATA, which is satisfied as long as there is a value that was not
+/// yet taken.
+/// @param[in] T user payload type; must be trivially copyable and default constructible
+template <typename T>
+class LatestValueSubscriber : public LatestValueSubscriberImpl<T>
+{
+  public:
+    using LatestValueSubscriberImpl<T>::LatestValueSubscriberImpl;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_HPP
@@ -45,6 +45,17 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the publisher caches free chunks in a port local magazine; this reduces the
+    /// contention on the mempools when many publishers loan in parallel but keeps up to MEMPOOL_MAGAZINE_CAPACITY
+    /// chunks reserved for this publisher
+    bool useChunkMagazine{false};
+
+    /// @brief The number of latest chunks the publisher keeps in a ring which is read by the subscribers with their own
+    /// cursor; this makes the cost of a publish independent of the number of subscribers. Subscribers which are too
+    /// slow lose the overwritten chunks. Subscribers with a blocking queue still get the chunks pushed into their
+    /// queue. A value of 0 disables the ring, the maximum is MAX_BROADCAST_RING_CAPACITY
+    uint64_t broadcastRingCapacity{0U};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
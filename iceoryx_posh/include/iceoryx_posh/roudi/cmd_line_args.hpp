@@ -44,6 +44,8 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
               << static_cast<roudi::UniqueRouDiId::value_type>(cmdLineArgs.roudiConfig.uniqueRouDiId) << "\n";
     logstream << "Process termination delay: " << cmdLineArgs.roudiConfig.processTerminationDelay.toSeconds() << " s\n";
     logstream << "Process kill delay: " << cmdLineArgs.roudiConfig.processKillDelay.toSeconds() << " s\n";
+    logstream << "Memory prefault mode: " << cmdLineArgs.roudiConfig.memoryPrefaultMode << "\n";
+    logstream << "Memory prefault thread count: " << cmdLineArgs.roudiConfig.memoryPrefaultThreadCount << "\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
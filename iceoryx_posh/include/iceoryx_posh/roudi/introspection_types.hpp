@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
@@ -41,6 +42,10 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint64_t m_chunkSize{0};
     uint64_t m_chunkPayloadSize{0};
+    /// @brief the NUMA node the chunks are bound to; nullopt if the chunks are not bound to a NUMA node
+    optional<uint32_t> m_numaNode;
+    /// @brief the number of chunks which were leaked by terminated applications and reclaimed by RouDi
+    uint64_t m_leakedChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -53,6 +58,10 @@ struct MemPoolIntrospectionInfo
     uint32_t m_id;
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
+    /// @brief the size of the pages which back the segment; larger than the system page size for huge pages
+    uint64_t m_pageSize;
+    /// @brief the NUMA node the segment is bound to; single mempools might be bound to other NUMA nodes
+    optional<uint32_t> m_numaNode;
     MemPoolInfoContainer m_mempoolInfo;
 };
 
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_ROUDI_MEMORY_MEMORY_BLOCK_HPP
 #define IOX_POSH_ROUDI_MEMORY_MEMORY_BLOCK_HPP
 
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
 
@@ -60,6 +61,12 @@ class MemoryBlock
     /// otherwise a nullopt_t
     optional<void*> memory() const noexcept;
 
+    /// @brief This function provides the memory which is managed by the underlying data but which is not part of the
+    /// memory from the MemoryProvider, e.g. the shared memory segments of the SegmentManager. It is used by the
+    /// RouDiMemoryManager to fault in all the memory at startup.
+    /// @param [in] callable is called with the start address and the size of each additional memory range
+    virtual void forEachAdditionalMemory(const function_ref<void(void*, uint64_t)> callable) const noexcept;
+
   protected:
     /// @brief The MemoryProvider calls this either when MemoryProvider::destroy is called or in its destructor.
     /// @note This function can be called multiple times. Make sure that the implementation can handle this.
@@ -53,6 +53,13 @@ class RouDiMemoryManager
 {
   public:
     RouDiMemoryManager() noexcept = default;
+
+    /// @brief Creates a RouDiMemoryManager which faults in the memory of all MemoryProvider and MemoryBlocks in
+    /// createAndAnnounceMemory
+    /// @param [in] prefaultMode specifies whether the memory is faulted in and whether it is locked into RAM
+    /// @param [in] prefaultThreadCount is the number of threads which share the work to fault in the memory
+    RouDiMemoryManager(const MemoryPrefaultMode prefaultMode, const uint32_t prefaultThreadCount) noexcept;
+
     /// @brief The Destructor of the RouDiMemoryManager also calls destroy on the registered MemoryProvider
     virtual ~RouDiMemoryManager() noexcept;
 
@@ -71,14 +78,33 @@ class RouDiMemoryManager
     /// @brief The RouDiMemoryManager calls the the MemoryProvider to create the memory and announce the availability
     /// to its MemoryBlocks
     /// @return an RouDiMemoryManagerError if the MemoryProvider cannot create the memory, otherwise success
+    /// @note depending on the MemoryPrefaultMode, the memory is faulted in and locked into RAM after the announcement
     expected<void, RouDiMemoryManagerError> createAndAnnounceMemory() noexcept;
 
     /// @brief The RouDiMemoryManager calls the the MemoryProvider to destroy the memory, which in turn prompts the
     /// MemoryBlocks to destroy their data
     expected<void, RouDiMemoryManagerError> destroyMemory() noexcept;
 
+  private:
+    struct MemoryRange
+    {
+        void* memory{nullptr};
+        uint64_t size{0U};
+    };
+
+    /// @note the memory of the MemoryProvider and the additional memory of the MemoryBlocks, i.e. the segments
+    using MemoryRanges_t = vector<MemoryRange, MAX_NUMBER_OF_MEMORY_PROVIDER + MAX_SHM_SEGMENTS>;
+
+    void prefaultMemory() noexcept;
+    static void prefaultMemoryRanges(const MemoryRanges_t& memoryRanges,
+                                     const uint64_t beginOffset,
+                                     const uint64_t endOffset,
+                                     const MemoryPrefaultMode prefaultMode) noexcept;
+
   private:
     vector<MemoryProvider*, MAX_NUMBER_OF_MEMORY_PROVIDER> m_memoryProvider;
+    MemoryPrefaultMode m_prefaultMode{MemoryPrefaultMode::OFF};
+    uint32_t m_prefaultThreadCount{1U};
 };
 } // namespace roudi
 } // namespace iox
@@ -68,6 +68,14 @@ class PortPool
     PortPoolData::InterfaceContainer& getInterfacePortDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the data via which the publisher, subscriber, server and client ports of the pool notify the
+    /// discovery loop about a change of their CaPro state
+    popo::DiscoveryNotificationData& getDiscoveryNotificationData() noexcept;
+
+    /// @brief Detaches all publisher, subscriber, server and client ports from the discovery notification; this is
+    /// done when the discovery loop has stopped since the ports which are destroyed afterwards must not notify it
+    void detachPortsFromDiscoveryNotification() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -159,6 +167,9 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+  private:
+    void attachToDiscoveryNotification(popo::BasePortData& portData, const uint64_t portIndex) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
 };
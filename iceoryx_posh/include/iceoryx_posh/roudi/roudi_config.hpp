@@ -46,6 +46,10 @@ struct RouDiConfig
     /// @brief Sets the delay in seconds before RouDi sends SIGKILL to application which did not respond to the initial
     /// SIGTERM signal
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    /// @brief Specifies whether the shared memory is faulted in and optionally locked into RAM at startup
+    roudi::MemoryPrefaultMode memoryPrefaultMode{roudi::MemoryPrefaultMode::OFF};
+    /// @brief The number of threads which are used to fault in the shared memory at startup
+    uint32_t memoryPrefaultThreadCount{1};
 
     // have some spare chunks to still deliver introspection data in case there are multiple subscribers to the data
     // which are caching different samples; could probably be reduced to 2 with the instruction to not cache the
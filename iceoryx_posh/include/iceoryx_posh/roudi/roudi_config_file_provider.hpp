@@ -35,6 +35,8 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_HUGE_PAGE_MOUNT_POINT - the huge page mount point of the segment is not a valid path
+/// INVALID_MEMPOOL_TYPE - the mempool type of the segment is neither 'fixed-size' nor 'buddy'
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +48,8 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_HUGE_PAGE_MOUNT_POINT,
+    INVALID_MEMPOOL_TYPE,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +62,8 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_HUGE_PAGE_MOUNT_POINT",
+                                                                 "INVALID_MEMPOOL_TYPE",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -0,0 +1,220 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
+#include "iox/assertions.hpp"
+#include "iox/memory.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t BuddyAllocator::MAX_NUMBER_OF_ORDERS;
+constexpr BuddyAllocator::State_t BuddyAllocator::STATE_ORDER_MASK;
+constexpr BuddyAllocator::State_t BuddyAllocator::STATE_FREE;
+constexpr BuddyAllocator::State_t BuddyAllocator::STATE_ALLOCATED;
+constexpr BuddyAllocator::State_t BuddyAllocator::STATE_NONE;
+constexpr BuddyAllocator::Index_t BuddyAllocator::INVALID_INDEX;
+
+namespace
+{
+constexpr uint64_t MANAGEMENT_MEMORY_ALIGNMENT{8U};
+} // namespace
+
+BuddyAllocator::BuddyAllocator(const uint32_t numberOfUnits,
+                               const uint32_t maxOrder,
+                               BumpAllocator& managementAllocator) noexcept
+    : m_numberOfUnits(numberOfUnits)
+    , m_maxOrder(maxOrder)
+{
+    IOX_ENFORCE(m_maxOrder < MAX_NUMBER_OF_ORDERS, "The maximum order of the buddy allocator is too large!");
+    const auto unitsOfLargestBlock = static_cast<uint32_t>(1U) << m_maxOrder;
+    IOX_ENFORCE(m_numberOfUnits > 0U && m_numberOfUnits % unitsOfLargestBlock == 0U,
+                "The number of units must be a multiple of the number of units of the largest block!");
+
+    m_states = static_cast<State_t*>(
+        managementAllocator.allocate(m_numberOfUnits * sizeof(State_t), MANAGEMENT_MEMORY_ALIGNMENT)
+            .expect("Allocating the states of the 'BuddyAllocator'"));
+    m_nextFree = static_cast<Index_t*>(
+        managementAllocator.allocate(m_numberOfUnits * sizeof(Index_t), MANAGEMENT_MEMORY_ALIGNMENT)
+            .expect("Allocating the free list of the 'BuddyAllocator'"));
+    m_previousFree = static_cast<Index_t*>(
+        managementAllocator.allocate(m_numberOfUnits * sizeof(Index_t), MANAGEMENT_MEMORY_ALIGNMENT)
+            .expect("Allocating the free list of the 'BuddyAllocator'"));
+
+    std::fill_n(m_states.get(), m_numberOfUnits, STATE_NONE);
+    std::fill_n(&m_freeListHeads[0], MAX_NUMBER_OF_ORDERS, INVALID_INDEX);
+
+    // initially all the memory consists of free blocks of the largest order; they are pushed in reverse order to
+    // hand out the blocks with the lower addresses first
+    for (auto index = m_numberOfUnits; index > 0U;)
+    {
+        index -= unitsOfLargestBlock;
+        m_states.get()[index] = static_cast<State_t>(STATE_FREE | m_maxOrder);
+        pushToFreeList(m_maxOrder, index);
+    }
+}
+
+uint64_t BuddyAllocator::requiredManagementMemorySize(const uint32_t numberOfUnits) noexcept
+{
+    return align(static_cast<uint64_t>(numberOfUnits) * sizeof(State_t), MANAGEMENT_MEMORY_ALIGNMENT)
+           + 2U * align(static_cast<uint64_t>(numberOfUnits) * sizeof(Index_t), MANAGEMENT_MEMORY_ALIGNMENT);
+}
+
+uint32_t BuddyAllocator::orderForNumberOfUnits(const uint64_t numberOfUnits) noexcept
+{
+    uint32_t order{0U};
+    while (order < MAX_NUMBER_OF_ORDERS && (static_cast<uint64_t>(1U) << order) < numberOfUnits)
+    {
+        ++order;
+    }
+    return order;
+}
+
+void BuddyAllocator::lock() noexcept
+{
+    while (m_lock.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+void BuddyAllocator::unlock() noexcept
+{
+    m_lock.clear(std::memory_order_release);
+}
+
+void BuddyAllocator::pushToFreeList(const uint32_t order, const Index_t index) noexcept
+{
+    const auto head = m_freeListHeads[order];
+    m_nextFree.get()[index] = head;
+    m_previousFree.get()[index] = INVALID_INDEX;
+    if (head != INVALID_INDEX)
+    {
+        m_previousFree.get()[head] = index;
+    }
+    m_freeListHeads[order] = index;
+}
+
+void BuddyAllocator::removeFromFreeList(const uint32_t order, const Index_t index) noexcept
+{
+    const auto next = m_nextFree.get()[index];
+    const auto previous = m_previousFree.get()[index];
+    if (previous != INVALID_INDEX)
+    {
+        m_nextFree.get()[previous] = next;
+    }
+    else
+    {
+        m_freeListHeads[order] = next;
+    }
+    if (next != INVALID_INDEX)
+    {
+        m_previousFree.get()[next] = previous;
+    }
+}
+
+optional<BuddyAllocator::Index_t> BuddyAllocator::allocate(const uint32_t order) noexcept
+{
+    if (order > m_maxOrder)
+    {
+        return nullopt;
+    }
+
+    lock();
+
+    auto blockOrder = order;
+    while (blockOrder <= m_maxOrder && m_freeListHeads[blockOrder] == INVALID_INDEX)
+    {
+        ++blockOrder;
+    }
+    if (blockOrder > m_maxOrder)
+    {
+        unlock();
+        return nullopt;
+    }
+
+    const auto index = m_freeListHeads[blockOrder];
+    removeFromFreeList(blockOrder, index);
+
+    // the upper halves of the split blocks become free blocks of the lower orders
+    while (blockOrder > order)
+    {
+        --blockOrder;
+        const auto buddyIndex = index + (static_cast<Index_t>(1U) << blockOrder);
+        m_states.get()[buddyIndex] = static_cast<State_t>(STATE_FREE | blockOrder);
+        pushToFreeList(blockOrder, buddyIndex);
+    }
+    m_states.get()[index] = static_cast<State_t>(STATE_ALLOCATED | order);
+
+    unlock();
+    return index;
+}
+
+optional<uint32_t> BuddyAllocator::deallocate(const Index_t index) noexcept
+{
+    if (index >= m_numberOfUnits)
+    {
+        return nullopt;
+    }
+
+    lock();
+
+    const auto state = m_states.get()[index];
+    if ((state & STATE_ALLOCATED) == 0U)
+    {
+        unlock();
+        return nullopt;
+    }
+    const auto order = static_cast<uint32_t>(state & STATE_ORDER_MASK);
+
+    m_states.get()[index] = STATE_NONE;
+    auto blockIndex = index;
+    auto blockOrder = order;
+    while (blockOrder < m_maxOrder)
+    {
+        const auto buddyIndex = blockIndex ^ (static_cast<Index_t>(1U) << blockOrder);
+        if (m_states.get()[buddyIndex] != static_cast<State_t>(STATE_FREE | blockOrder))
+        {
+            break;
+        }
+        removeFromFreeList(blockOrder, buddyIndex);
+        m_states.get()[buddyIndex] = STATE_NONE;
+        blockIndex = std::min(blockIndex, buddyIndex);
+        ++blockOrder;
+    }
+    m_states.get()[blockIndex] = static_cast<State_t>(STATE_FREE | blockOrder);
+    pushToFreeList(blockOrder, blockIndex);
+
+    unlock();
+    return order;
+}
+
+uint32_t BuddyAllocator::getNumberOfUnits() const noexcept
+{
+    return m_numberOfUnits;
+}
+
+uint32_t BuddyAllocator::getMaxOrder() const noexcept
+{
+    return m_maxOrder;
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -34,6 +34,16 @@ ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_mempool(mempool)
+{
+}
+
+bool ChunkManagement::isEmbeddedInChunk() const noexcept
+{
+    return m_chunkManagementPool.get() == nullptr;
+}
 
 } // namespace mepoo
 } // namespace iox
@@ -20,8 +20,11 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/assertions.hpp"
+#include "iox/detail/posix_numa.hpp"
+#include "iox/detail/posix_prefault.hpp"
 
 #include <algorithm>
+#include <new>
 
 namespace iox
 {
@@ -30,47 +33,110 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint64_t chunkSize) noexcept
+                         const uint64_t chunkSize,
+                         const optional<uint32_t> numaNode) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_numaNode(numaNode)
 {
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint32_t MemPool::RELEASING_OVERFLOW_MEMORY;
 
 MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
                  iox::BumpAllocator& managementAllocator,
-                 iox::BumpAllocator& chunkMemoryAllocator) noexcept
+                 iox::BumpAllocator& chunkMemoryAllocator,
+                 const optional<uint32_t> numaNode,
+                 const uint32_t numberOfOverflowChunks) noexcept
     : m_chunkSize(chunkSize)
     , m_numberOfChunks(numberOfChunks)
+    , m_numaNode(numaNode)
     , m_minFree(numberOfChunks)
+    , m_numberOfOverflowChunks(numberOfOverflowChunks)
 {
+    IOX_ENFORCE(numberOfOverflowChunks < RELEASING_OVERFLOW_MEMORY
+                    && numberOfOverflowChunks <= std::numeric_limits<uint32_t>::max() - m_numberOfChunks,
+                "Too many overflow chunks!");
+
     if (isMultipleOfAlignment(chunkSize))
     {
-        IOX_ENFORCE(m_chunkSize <= std::numeric_limits<uint64_t>::max() / m_numberOfChunks,
-                    "Chunk size * number of chunks must not exceed the maximum value of uint64_t!");
-
-        m_rawMemory = static_cast<uint8_t*>(
-            chunkMemoryAllocator.allocate(static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize, CHUNK_MEMORY_ALIGNMENT)
-                .expect("Allocating raw memory for 'MemPool'"));
+        allocateChunkMemory(chunkMemoryAllocator);
 
         auto* memoryFreeList =
             managementAllocator.allocate(freeList_t::requiredIndexMemorySize(m_numberOfChunks), CHUNK_MEMORY_ALIGNMENT)
                 .expect("Allocating free list memory for 'MemPool'");
         m_freeIndices.init(static_cast<freeList_t::Index_t*>(memoryFreeList), m_numberOfChunks);
+
+        if (m_numberOfOverflowChunks > 0U)
+        {
+            auto* memoryOverflowFreeList =
+                managementAllocator
+                    .allocate(freeList_t::requiredIndexMemorySize(m_numberOfOverflowChunks), CHUNK_MEMORY_ALIGNMENT)
+                    .expect("Allocating overflow free list memory for 'MemPool'");
+            m_freeOverflowIndices.init(static_cast<freeList_t::Index_t*>(memoryOverflowFreeList),
+                                       m_numberOfOverflowChunks);
+        }
     }
     else
     {
-        IOX_LOG(Fatal,
-                "Chunk size must be multiple of '" << CHUNK_MEMORY_ALIGNMENT << "'! Requested size is " << chunkSize
-                                                   << " for " << numberOfChunks << " chunks!");
-        IOX_REPORT_FATAL(PoshError::MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT);
+        reportInvalidChunkSize();
     }
 }
 
+MemPool::MemPool(const greater_or_equal<uint64_t, CHUNK_MEMORY_ALIGNMENT> minChunkSize,
+                 const greater_or_equal<uint32_t, 1> numberOfMinChunks,
+                 const uint32_t maxOrder,
+                 iox::BumpAllocator& managementAllocator,
+                 iox::BumpAllocator& chunkMemoryAllocator,
+                 const optional<uint32_t> numaNode) noexcept
+    : m_chunkSize(minChunkSize)
+    , m_numberOfChunks(numberOfMinChunks)
+    , m_numaNode(numaNode)
+    , m_minFree(numberOfMinChunks)
+{
+    if (isMultipleOfAlignment(minChunkSize))
+    {
+        allocateChunkMemory(chunkMemoryAllocator);
+
+        auto* buddyAllocatorMemory = managementAllocator.allocate(sizeof(BuddyAllocator), alignof(BuddyAllocator))
+                                         .expect("Allocating the buddy allocator for 'MemPool'");
+        m_buddyAllocator = new (buddyAllocatorMemory) BuddyAllocator(m_numberOfChunks, maxOrder, managementAllocator);
+    }
+    else
+    {
+        reportInvalidChunkSize();
+    }
+}
+
+void MemPool::allocateChunkMemory(iox::BumpAllocator& chunkMemoryAllocator) noexcept
+{
+    const auto totalNumberOfChunks = m_numberOfChunks + m_numberOfOverflowChunks;
+    IOX_ENFORCE(m_chunkSize <= std::numeric_limits<uint64_t>::max() / totalNumberOfChunks,
+                "Chunk size * number of chunks must not exceed the maximum value of uint64_t!");
+
+    const auto chunkMemorySize = static_cast<uint64_t>(totalNumberOfChunks) * m_chunkSize;
+    m_rawMemory = static_cast<uint8_t*>(chunkMemoryAllocator.allocate(chunkMemorySize, CHUNK_MEMORY_ALIGNMENT)
+                                            .expect("Allocating raw memory for 'MemPool'"));
+
+    if (m_numaNode.has_value())
+    {
+        // the binding is only a performance optimization, the MemPool is fully functional without it
+        detail::bindMemoryToNumaNode(m_rawMemory.get(), chunkMemorySize, m_numaNode.value());
+    }
+}
+
+void MemPool::reportInvalidChunkSize() const noexcept
+{
+    IOX_LOG(Fatal,
+            "Chunk size must be multiple of '" << CHUNK_MEMORY_ALIGNMENT << "'! Requested size is " << m_chunkSize
+                                               << " for " << m_numberOfChunks << " chunks!");
+    IOX_REPORT_FATAL(PoshError::MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_MULTIPLE_OF_CHUNK_MEMORY_ALIGNMENT);
+}
+
 bool MemPool::isMultipleOfAlignment(const uint64_t value) const noexcept
 {
     return (value % CHUNK_MEMORY_ALIGNMENT == 0U);
@@ -85,6 +151,11 @@ void MemPool::adjustMinFree() noexcept
 
 void* MemPool::getChunk() noexcept
 {
+    if (m_buddyAllocator)
+    {
+        return getChunk(m_chunkSize);
+    }
+
     uint32_t index{0U};
     if (!m_freeIndices.pop(index))
     {
@@ -102,6 +173,54 @@ void* MemPool::getChunk() noexcept
     return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
 
+void* MemPool::getChunk(const uint64_t requiredChunkSize) noexcept
+{
+    if (!m_buddyAllocator)
+    {
+        return (requiredChunkSize <= m_chunkSize) ? getChunk() : nullptr;
+    }
+
+    const auto order = BuddyAllocator::orderForNumberOfUnits((requiredChunkSize + m_chunkSize - 1U) / m_chunkSize);
+    auto index = m_buddyAllocator->allocate(order);
+    if (!index.has_value())
+    {
+        IOX_LOG(Warn,
+                "Buddy mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                                                << ", used_chunks = " << m_usedChunks.load()
+                                                << " ] has no chunk with a size of " << (m_chunkSize << order)
+                                                << " left");
+        return nullptr;
+    }
+
+    m_usedChunks.fetch_add(static_cast<uint32_t>(1U) << order, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return indexToPointer(index.value(), m_chunkSize, m_rawMemory.get());
+}
+
+uint64_t MemPool::getChunkSizeFor(const uint64_t requiredChunkSize) const noexcept
+{
+    if (requiredChunkSize > getMaxChunkSize())
+    {
+        return 0U;
+    }
+    if (!m_buddyAllocator)
+    {
+        return m_chunkSize;
+    }
+    return m_chunkSize << BuddyAllocator::orderForNumberOfUnits((requiredChunkSize + m_chunkSize - 1U) / m_chunkSize);
+}
+
+uint64_t MemPool::getMaxChunkSize() const noexcept
+{
+    return m_buddyAllocator ? (m_chunkSize << m_buddyAllocator->getMaxOrder()) : m_chunkSize;
+}
+
+bool MemPool::isBuddyMemPool() const noexcept
+{
+    return static_cast<bool>(m_buddyAllocator);
+}
+
 void* MemPool::indexToPointer(uint32_t index, uint64_t chunkSize, void* const rawMemoryBase) noexcept
 {
     const auto offset = static_cast<uint64_t>(index) * chunkSize;
@@ -126,10 +245,97 @@ MemPool::pointerToIndex(const void* const chunk, const uint64_t chunkSize, const
     return index;
 }
 
+void* MemPool::getOverflowChunk() noexcept
+{
+    if (m_numberOfOverflowChunks == 0U)
+    {
+        return nullptr;
+    }
+
+    // the usage counter is incremented before the free list is accessed; this prevents the release of the overflow
+    // memory while a chunk is obtained
+    auto usedOverflowChunks = m_usedOverflowChunks.load(std::memory_order_relaxed);
+    do
+    {
+        if ((usedOverflowChunks & RELEASING_OVERFLOW_MEMORY) != 0U)
+        {
+            return nullptr;
+        }
+    } while (!m_usedOverflowChunks.compare_exchange_weak(
+        usedOverflowChunks, usedOverflowChunks + 1U, std::memory_order_acquire, std::memory_order_relaxed));
+
+    uint32_t index{0U};
+    if (!m_freeOverflowIndices.pop(index))
+    {
+        m_usedOverflowChunks.fetch_sub(1U, std::memory_order_relaxed);
+        IOX_LOG(Warn,
+                "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfOverflowChunks = " << m_numberOfOverflowChunks
+                                          << " ] has no more overflow chunks left");
+        return nullptr;
+    }
+
+    m_overflowChunkObtained.store(true, std::memory_order_relaxed);
+    if (usedOverflowChunks == 0U)
+    {
+        IOX_LOG(Info,
+                "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                                          << " ] is exhausted and uses its overflow chunks");
+    }
+
+    return indexToPointer(m_numberOfChunks + index, m_chunkSize, m_rawMemory.get());
+}
+
+bool MemPool::releaseIdleOverflowMemory() noexcept
+{
+    if (m_numberOfOverflowChunks == 0U)
+    {
+        return false;
+    }
+
+    // the memory is only released after a whole period without any obtained overflow chunk in order to prevent a
+    // release and refault cycle for a MemPool which is frequently at its limit
+    if (m_overflowChunkObtained.exchange(false, std::memory_order_relaxed))
+    {
+        m_hasCommittedOverflowMemory = true;
+        return false;
+    }
+    if (!m_hasCommittedOverflowMemory)
+    {
+        return false;
+    }
+
+    uint32_t noUsedOverflowChunks{0U};
+    if (!m_usedOverflowChunks.compare_exchange_strong(
+            noUsedOverflowChunks, RELEASING_OVERFLOW_MEMORY, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    // only the pages which belong completely to the overflow chunks are released
+    auto* overflowMemory = indexToPointer(m_numberOfChunks, m_chunkSize, m_rawMemory.get());
+    const auto released =
+        detail::releaseMemory(overflowMemory, static_cast<uint64_t>(m_numberOfOverflowChunks) * m_chunkSize);
+    m_hasCommittedOverflowMemory = false;
+
+    m_usedOverflowChunks.store(0U, std::memory_order_release);
+    return released;
+}
+
+void MemPool::freeOverflowChunk(const uint32_t index) noexcept
+{
+    if (!m_freeOverflowIndices.push(index - m_numberOfChunks))
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    // the chunk must be back in the free list before the usage counter allows the release of the overflow memory
+    m_usedOverflowChunks.fetch_sub(1U, std::memory_order_release);
+}
+
 void MemPool::freeChunk(const void* chunk) noexcept
 {
     const auto memPoolStartAddress = m_rawMemory.get();
-    const auto offsetToLastChunk = m_chunkSize * (m_numberOfChunks - 1U);
+    const auto offsetToLastChunk = m_chunkSize * (m_numberOfChunks + m_numberOfOverflowChunks - 1U);
     if (chunk < memPoolStartAddress)
     {
         IOX_LOG(Fatal,
@@ -149,6 +355,18 @@ void MemPool::freeChunk(const void* chunk) noexcept
 
     const auto index = pointerToIndex(chunk, m_chunkSize, memPoolStartAddress);
 
+    if (m_buddyAllocator)
+    {
+        freeBuddyChunk(index);
+        return;
+    }
+
+    if (index >= m_numberOfChunks)
+    {
+        freeOverflowChunk(index);
+        return;
+    }
+
     if (!m_freeIndices.push(index))
     {
         IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
@@ -157,6 +375,79 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+void MemPool::freeBuddyChunk(const uint32_t index) noexcept
+{
+    auto order = m_buddyAllocator->deallocate(index);
+    if (!order.has_value())
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(static_cast<uint32_t>(1U) << order.value(), std::memory_order_relaxed);
+}
+
+uint32_t MemPool::getChunks(uint32_t* const chunkIndices, const uint32_t maxNumberOfChunks) noexcept
+{
+    if (m_buddyAllocator)
+    {
+        // there is no bulk operation for the buddy allocator; the smallest chunks are acquired one by one
+        uint32_t numberOfChunks{0U};
+        for (; numberOfChunks < maxNumberOfChunks; ++numberOfChunks)
+        {
+            auto* chunk = getChunk(m_chunkSize);
+            if (chunk == nullptr)
+            {
+                break;
+            }
+            chunkIndices[numberOfChunks] = pointerToIndex(chunk, m_chunkSize, m_rawMemory.get());
+        }
+        return numberOfChunks;
+    }
+
+    const auto numberOfChunks = m_freeIndices.pop(chunkIndices, maxNumberOfChunks);
+    if (numberOfChunks == 0U)
+    {
+        if (maxNumberOfChunks > 0U)
+        {
+            IOX_LOG(Warn,
+                    "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                                              << ", used_chunks = " << m_usedChunks.load()
+                                              << " ] has no more space left");
+        }
+        return 0U;
+    }
+
+    m_usedChunks.fetch_add(numberOfChunks, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return numberOfChunks;
+}
+
+void MemPool::freeChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    if (m_buddyAllocator)
+    {
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            freeBuddyChunk(chunkIndices[i]);
+        }
+        return;
+    }
+
+    if (!m_freeIndices.push(chunkIndices, numberOfChunks))
+    {
+        IOX_REPORT_FATAL(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
+void* MemPool::chunkFromIndex(const uint32_t index) const noexcept
+{
+    IOX_ENFORCE(index < m_numberOfChunks, "Chunk index out of bounds");
+    return indexToPointer(index, m_chunkSize, m_rawMemory.get());
+}
+
 uint64_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -172,6 +463,16 @@ uint32_t MemPool::getUsedChunks() const noexcept
     return m_usedChunks.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getOverflowChunkCount() const noexcept
+{
+    return m_numberOfOverflowChunks;
+}
+
+uint32_t MemPool::getUsedOverflowChunks() const noexcept
+{
+    return m_usedOverflowChunks.load(std::memory_order_relaxed) & ~RELEASING_OVERFLOW_MEMORY;
+}
+
 uint32_t MemPool::getMinFree() const noexcept
 {
     return m_minFree.load(std::memory_order_relaxed);
@@ -179,10 +480,30 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
-            m_minFree.load(std::memory_order_relaxed),
-            m_numberOfChunks,
-            m_chunkSize};
+    MemPoolInfo info{m_usedChunks.load(std::memory_order_relaxed),
+                     m_minFree.load(std::memory_order_relaxed),
+                     m_numberOfChunks,
+                     m_chunkSize,
+                     m_numaNode};
+    info.m_numOverflowChunks = m_numberOfOverflowChunks;
+    info.m_usedOverflowChunks = getUsedOverflowChunks();
+    info.m_leakedChunks = getLeakedChunks();
+    return info;
+}
+
+void MemPool::incrementLeakedChunks() noexcept
+{
+    m_leakedChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getLeakedChunks() const noexcept
+{
+    return m_leakedChunks.load(std::memory_order_relaxed);
+}
+
+optional<uint32_t> MemPool::getNumaNode() const noexcept
+{
+    return m_numaNode;
 }
 
 } // namespace mepoo
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_magazine.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+constexpr uint32_t MemPoolMagazine::CAPACITY;
+
+void* MemPoolMagazine::getChunk(MemPool& memPool, const uint32_t maxNumberOfChunksToAcquire) noexcept
+{
+    if (m_memPool.get() != &memPool)
+    {
+        drain();
+        m_memPool = &memPool;
+    }
+
+    if (m_numberOfChunks == 0U)
+    {
+        // BEGIN of critical section, the chunks will be lost if the process terminates in this section
+        m_numberOfChunks = memPool.getChunks(&m_chunkIndices[0], std::min(maxNumberOfChunksToAcquire, CAPACITY));
+        // END of critical section
+
+        if (m_numberOfChunks == 0U)
+        {
+            return nullptr;
+        }
+    }
+
+    --m_numberOfChunks;
+    return memPool.chunkFromIndex(m_chunkIndices[m_numberOfChunks]);
+}
+
+void MemPoolMagazine::drain() noexcept
+{
+    if (m_numberOfChunks == 0U || m_memPool.get() == nullptr)
+    {
+        return;
+    }
+
+    // the magazine is emptied before the chunks are returned in order to prevent a double free by RouDi in case the
+    // process terminates in between
+    const auto numberOfChunks = m_numberOfChunks;
+    m_numberOfChunks = 0U;
+    // BEGIN of critical section, the chunks will be lost if the process terminates in this section
+    m_memPool->freeChunks(&m_chunkIndices[0], numberOfChunks);
+    // END of critical section
+}
+
+uint32_t MemPoolMagazine::size() const noexcept
+{
+    return m_numberOfChunks;
+}
+
+void* ChunkMagazine::getChunk(MemPool& memPool) noexcept
+{
+    auto* chunk = m_chunks.getChunk(memPool);
+
+    // the chunks are drained when the mempool changes; in this case the ChunkManagements would exceed the chunks
+    const uint32_t numberOfObtainedChunks = (chunk != nullptr) ? 1U : 0U;
+    if (m_chunkManagements.size() > m_chunks.size() + numberOfObtainedChunks)
+    {
+        m_chunkManagements.drain();
+    }
+
+    return chunk;
+}
+
+void* ChunkMagazine::getChunkManagement(MemPool& chunkManagementPool) noexcept
+{
+    // one ChunkManagement for each cached chunk plus one for the chunk which was just obtained
+    return m_chunkManagements.getChunk(chunkManagementPool, m_chunks.size() + 1U);
+}
+
+void ChunkMagazine::drain() noexcept
+{
+    m_chunks.drain();
+    m_chunkManagements.drain();
+}
+
+} // namespace mepoo
+} // namespace iox
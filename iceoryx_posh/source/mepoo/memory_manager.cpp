@@ -20,36 +20,70 @@
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/detail/posix_numa.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
 namespace mepoo
 {
+namespace
+{
+/// @brief floor(log2(value)) with a fixed number of steps; 0 for a value of 0
+constexpr uint32_t floorLog2(uint64_t value) noexcept
+{
+    uint32_t result{0U};
+    for (uint32_t shift : {32U, 16U, 8U, 4U, 2U, 1U})
+    {
+        if (value >= (static_cast<uint64_t>(1U) << shift))
+        {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+} // namespace
+
+constexpr uint32_t MemoryManager::NUMBER_OF_SIZE_CLASSES;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
     {
         log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
-            << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-            << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
+            << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader) - m_embeddedChunkManagementSize
+            << ", ChunkCount = " << l_mempool.getChunkCount()
+            << ", OverflowChunkCount = " << l_mempool.getOverflowChunkCount() << " ]";
     }
 }
 
 void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
                                BumpAllocator& chunkMemoryAllocator,
                                const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
-                               const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
+                               const greater_or_equal<uint32_t, 1> numberOfChunks,
+                               const optional<uint32_t> numaNode,
+                               const uint32_t numberOfOverflowChunks) noexcept
 {
-    uint64_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize));
+    uint64_t adjustedChunkSize =
+        sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize)) + m_embeddedChunkManagementSize;
+
+    // mempools with the same chunk size are allowed when they are bound to different NUMA nodes in increasing order
+    const bool isNumaVariantOfPreviousMemPool =
+        m_memPoolVector.size() > 0 && adjustedChunkSize == m_memPoolVector.back().getChunkSize()
+        && numaNode.has_value() && m_memPoolVector.back().getNumaNode().has_value()
+        && numaNode.value() > m_memPoolVector.back().getNumaNode().value();
     if (m_denyAddMemPool)
     {
         IOX_LOG(Fatal, "After the generation of the chunk management pool you are not allowed to create new mempools.");
         IOX_REPORT_FATAL(iox::PoshError::MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
-    else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
+    else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize()
+             && !isNumaVariantOfPreviousMemPool)
     {
         IOX_LOG(
             Fatal,
@@ -63,17 +97,120 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
         IOX_REPORT_FATAL(iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
-    m_totalNumberOfChunks += numberOfChunks;
+    m_hasNumaLocalMemPools = m_hasNumaLocalMemPools || isNumaVariantOfPreviousMemPool;
+    m_memPoolVector.emplace_back(
+        adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator, numaNode, numberOfOverflowChunks);
+    // the overflow chunks require a ChunkManagement as well
+    m_totalNumberOfChunks += numberOfChunks + numberOfOverflowChunks;
+}
+
+void MemoryManager::addBuddyMemPool(BumpAllocator& managementAllocator,
+                                    BumpAllocator& chunkMemoryAllocator,
+                                    const MePooConfig& mePooConfig) noexcept
+{
+    const auto layout = buddyMemPoolLayout(mePooConfig);
+    if (layout.numberOfMinChunks == 0U)
+    {
+        return;
+    }
+
+    // there is only one chunk memory, therefore it can only be bound to a NUMA node if all entries agree on it
+    auto numaNode = mePooConfig.m_mempoolConfig.front().m_numaNode;
+    for (const auto& entry : mePooConfig.m_mempoolConfig)
+    {
+        if (entry.m_numaNode != numaNode)
+        {
+            IOX_LOG(Warn, "The mempools of a buddy mempool have different NUMA nodes! The memory is not bound.");
+            numaNode.reset();
+            break;
+        }
+    }
+
+    for (const auto& entry : mePooConfig.m_mempoolConfig)
+    {
+        if (entry.m_overflowChunkCount > 0U)
+        {
+            IOX_LOG(Warn, "The buddy mempool does not support overflow chunks! The overflow count is ignored.");
+            break;
+        }
+    }
+
+    m_memPoolVector.emplace_back(layout.minChunkSize,
+                                 layout.numberOfMinChunks,
+                                 layout.maxOrder,
+                                 managementAllocator,
+                                 chunkMemoryAllocator,
+                                 numaNode);
+    m_totalNumberOfChunks += layout.numberOfMinChunks;
+    m_hasBuddyMemPool = true;
 }
 
 void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept
 {
     m_denyAddMemPool = true;
+    if (m_embeddedChunkManagementSize > 0U)
+    {
+        return;
+    }
     uint64_t chunkSize = sizeof(ChunkManagement);
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t lowerBoundOfSizeClass = static_cast<uint64_t>(1U) << sizeClass;
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < lowerBoundOfSizeClass)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassToMemPoolIndex[sizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::findMemPoolIndex(const uint64_t requiredChunkSize) const noexcept
+{
+    // the size class leads directly to the first mempool which might fit; since the mempools are ordered by increasing
+    // chunk size, only the mempools within the same size class have to be checked
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = m_sizeClassToMemPoolIndex[floorLog2(requiredChunkSize)];
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
+uint32_t MemoryManager::findNumaLocalMemPoolIndex(const uint32_t memPoolIndex) const noexcept
+{
+    const auto numaNode = detail::numaNodeOfCurrentThread();
+    if (!numaNode.has_value())
+    {
+        return memPoolIndex;
+    }
+
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const auto chunkSize = m_memPoolVector[memPoolIndex].getChunkSize();
+    for (auto index = memPoolIndex;
+         index < numberOfMemPools && m_memPoolVector[index].getChunkSize() == chunkSize;
+         ++index)
+    {
+        if (m_memPoolVector[index].getNumaNode() == numaNode)
+        {
+            return index;
+        }
+    }
+    return memPoolIndex;
+}
+
+void* MemoryManager::getChunkFromMemPool(MemPool& memPool, ChunkMagazine* const chunkMagazine) noexcept
+{
+    return (chunkMagazine != nullptr) ? chunkMagazine->getChunk(memPool) : memPool.getChunk();
+}
+
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
     return static_cast<uint32_t>(m_memPoolVector.size());
@@ -88,13 +225,76 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
     return m_memPoolVector[index].getInfo();
 }
 
+void MemoryManager::releaseIdleOverflowMemory() noexcept
+{
+    for (auto& memPool : m_memPoolVector)
+    {
+        memPool.releaseIdleOverflowMemory();
+    }
+}
+
 uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + sizeof(ChunkHeader);
 }
 
+uint64_t MemoryManager::embeddedChunkManagementSize(const MePooConfig& mePooConfig) noexcept
+{
+    // the ChunkHeader follows the embedded ChunkManagement and must therefore keep the alignment of the chunk memory
+    return mePooConfig.m_embedChunkManagement
+               ? align(static_cast<uint64_t>(sizeof(ChunkManagement)), MemPool::CHUNK_MEMORY_ALIGNMENT)
+               : 0U;
+}
+
+MemoryManager::BuddyMemPoolLayout MemoryManager::buddyMemPoolLayout(const MePooConfig& mePooConfig) noexcept
+{
+    BuddyMemPoolLayout layout;
+    if (mePooConfig.m_mempoolConfig.empty())
+    {
+        return layout;
+    }
+
+    for (const auto& entry : mePooConfig.m_mempoolConfig)
+    {
+        const auto chunkSize =
+            align(sizeWithChunkHeaderStruct(entry.m_size) + embeddedChunkManagementSize(mePooConfig),
+                  MemPool::CHUNK_MEMORY_ALIGNMENT);
+        layout.minChunkSize = (layout.minChunkSize == 0U) ? chunkSize : std::min(layout.minChunkSize, chunkSize);
+    }
+
+    // the configured chunks are the worst case mix which must fit into the chunk memory at the same time; each of
+    // them occupies a power of two of the smallest chunks
+    uint64_t numberOfMinChunks{0U};
+    for (const auto& entry : mePooConfig.m_mempoolConfig)
+    {
+        const auto chunkSize =
+            align(sizeWithChunkHeaderStruct(entry.m_size) + embeddedChunkManagementSize(mePooConfig),
+                  MemPool::CHUNK_MEMORY_ALIGNMENT);
+        const auto order =
+            BuddyAllocator::orderForNumberOfUnits((chunkSize + layout.minChunkSize - 1U) / layout.minChunkSize);
+        IOX_ENFORCE(order < BuddyAllocator::MAX_NUMBER_OF_ORDERS,
+                    "The largest chunk of a buddy mempool is too large compared to the smallest chunk!");
+        layout.maxOrder = std::max(layout.maxOrder, order);
+        numberOfMinChunks += static_cast<uint64_t>(entry.m_chunkCount) << order;
+    }
+
+    // the chunk memory consists of a whole number of the largest chunks
+    numberOfMinChunks = align(numberOfMinChunks, static_cast<uint64_t>(1U) << layout.maxOrder);
+    IOX_ENFORCE(numberOfMinChunks <= std::numeric_limits<uint32_t>::max(),
+                "The chunk memory of a buddy mempool consists of too many of the smallest chunks!");
+
+    layout.numberOfMinChunks = static_cast<uint32_t>(numberOfMinChunks);
+    return layout;
+}
+
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept
 {
+    if (mePooConfig.m_memPoolType == MemPoolType::BUDDY)
+    {
+        const auto layout = buddyMemPoolLayout(mePooConfig);
+        return static_cast<uint64_t>(layout.numberOfMinChunks) * layout.minChunkSize;
+    }
+
     uint64_t memorySize{0};
     for (const auto& mempoolConfig : mePooConfig.m_mempoolConfig)
     {
@@ -102,8 +302,9 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
         // and the the chunk-payload size is taken into account;
         // the user has the option to further partition the chunk-payload with
         // a user-header and therefore reduce the user-payload size
-        memorySize += align(static_cast<uint64_t>(mempoolConfig.m_chunkCount)
-                                * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
+        memorySize += align((static_cast<uint64_t>(mempoolConfig.m_chunkCount) + mempoolConfig.m_overflowChunkCount)
+                                * (MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size)
+                                   + embeddedChunkManagementSize(mePooConfig)),
                             MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
     return memorySize;
@@ -113,15 +314,36 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
 {
     uint64_t memorySize{0U};
     uint64_t sumOfAllChunks{0U};
-    for (const auto& mempool : mePooConfig.m_mempoolConfig)
+    if (mePooConfig.m_memPoolType == MemPoolType::BUDDY)
     {
-        sumOfAllChunks += mempool.m_chunkCount;
-        memorySize +=
-            align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        const auto layout = buddyMemPoolLayout(mePooConfig);
+        // the chunk memory can be used completely by the smallest chunks, each of them requires a ChunkManagement
+        sumOfAllChunks = layout.numberOfMinChunks;
+        memorySize += align(sizeof(BuddyAllocator), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += BuddyAllocator::requiredManagementMemorySize(layout.numberOfMinChunks);
+    }
+    else
+    {
+        for (const auto& mempool : mePooConfig.m_mempoolConfig)
+        {
+            sumOfAllChunks += static_cast<uint64_t>(mempool.m_chunkCount) + mempool.m_overflowChunkCount;
+            memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount),
+                                MemPool::CHUNK_MEMORY_ALIGNMENT);
+            if (mempool.m_overflowChunkCount > 0U)
+            {
+                memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_overflowChunkCount),
+                                    MemPool::CHUNK_MEMORY_ALIGNMENT);
+            }
+        }
     }
 
-    memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    // the embedded ChunkManagements are part of the chunk memory
+    if (!mePooConfig.m_embedChunkManagement)
+    {
+        memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize +=
+            align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    }
 
     return memorySize;
 }
@@ -135,32 +357,188 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            BumpAllocator& managementAllocator,
                                            BumpAllocator& chunkMemoryAllocator) noexcept
 {
-    for (auto entry : mePooConfig.m_mempoolConfig)
+    m_embeddedChunkManagementSize = embeddedChunkManagementSize(mePooConfig);
+
+    if (mePooConfig.m_memPoolType == MemPoolType::BUDDY)
     {
-        addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
+        addBuddyMemPool(managementAllocator, chunkMemoryAllocator, mePooConfig);
+    }
+    else
+    {
+        for (auto entry : mePooConfig.m_mempoolConfig)
+        {
+            addMemPool(managementAllocator,
+                       chunkMemoryAllocator,
+                       entry.m_size,
+                       entry.m_chunkCount,
+                       entry.m_numaNode,
+                       entry.m_overflowChunkCount);
+        }
     }
 
+    m_fallbackToLargerMemPool = mePooConfig.m_fallbackToLargerMemPool;
+
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
-    void* chunk{nullptr};
-    MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    return getChunkImpl(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkMagazine& chunkMagazine) noexcept
+{
+    // the magazines cache chunks of one size and are therefore not used for the buddy mempool
+    return getChunkImpl(chunkSettings, m_hasBuddyMemPool ? nullptr : &chunkMagazine);
+}
 
-    uint64_t aquiredChunkSize = 0U;
+expected<void, MemoryManager::Error> MemoryManager::getChunks(const ChunkSettings& chunkSettings,
+                                                              SharedChunk* const chunks,
+                                                              const uint32_t numberOfChunks) noexcept
+{
+    uint32_t numberOfObtainedChunks{0U};
+    if (!m_hasBuddyMemPool)
+    {
+        const auto memPoolIndex = findMemPoolIndex(chunkSettings.requiredChunkSize() + m_embeddedChunkManagementSize);
+        if (memPoolIndex < m_memPoolVector.size())
+        {
+            const auto preferredMemPoolIndex =
+                m_hasNumaLocalMemPools ? findNumaLocalMemPoolIndex(memPoolIndex) : memPoolIndex;
+            numberOfObtainedChunks = getChunksFromMemPool(
+                m_memPoolVector[preferredMemPoolIndex], chunkSettings, chunks, numberOfChunks);
+        }
+    }
 
-    for (auto& memPool : m_memPoolVector)
+    // the remaining chunks are obtained one by one, e.g. from the mempools on the other NUMA nodes, from larger
+    // mempools or from the buddy mempool
+    for (; numberOfObtainedChunks < numberOfChunks; ++numberOfObtainedChunks)
+    {
+        auto result = getChunkImpl(chunkSettings, nullptr);
+        if (result.has_error())
+        {
+            for (uint32_t i = 0U; i < numberOfObtainedChunks; ++i)
+            {
+                chunks[i] = nullptr;
+            }
+            return err(result.error());
+        }
+        chunks[numberOfObtainedChunks] = std::move(result.value());
+    }
+
+    return ok();
+}
+
+uint32_t MemoryManager::getChunksFromMemPool(MemPool& memPool,
+                                             const ChunkSettings& chunkSettings,
+                                             SharedChunk* const chunks,
+                                             const uint32_t numberOfChunks) noexcept
+{
+    uint32_t chunkIndices[CHUNK_BULK_SIZE];
+    uint32_t chunkManagementIndices[CHUNK_BULK_SIZE];
+
+    uint32_t numberOfObtainedChunks{0U};
+    while (numberOfObtainedChunks < numberOfChunks)
     {
-        uint64_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        const auto numberOfRequestedChunks = std::min(numberOfChunks - numberOfObtainedChunks, CHUNK_BULK_SIZE);
+        const auto numberOfPoppedChunks = memPool.getChunks(&chunkIndices[0], numberOfRequestedChunks);
+        if (numberOfPoppedChunks == 0U)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
             break;
         }
+
+        // there is one ChunkManagement for each chunk, therefore they cannot run out before the chunks
+        if (m_embeddedChunkManagementSize == 0U)
+        {
+            const auto numberOfPoppedChunkManagements =
+                m_chunkManagementPool.front().getChunks(&chunkManagementIndices[0], numberOfPoppedChunks);
+            IOX_ENFORCE(numberOfPoppedChunkManagements == numberOfPoppedChunks, "Ran out of ChunkManagements!");
+        }
+
+        for (uint32_t i = 0U; i < numberOfPoppedChunks; ++i)
+        {
+            auto chunkManagementMemory = (m_embeddedChunkManagementSize == 0U)
+                                             ? m_chunkManagementPool.front().chunkFromIndex(chunkManagementIndices[i])
+                                             : nullptr;
+            chunks[numberOfObtainedChunks] = constructChunk(memPool.chunkFromIndex(chunkIndices[i]),
+                                                            memPool,
+                                                            memPool.getChunkSize(),
+                                                            chunkSettings,
+                                                            chunkManagementMemory);
+            ++numberOfObtainedChunks;
+        }
+
+        if (numberOfPoppedChunks < numberOfRequestedChunks)
+        {
+            break;
+        }
+    }
+
+    return numberOfObtainedChunks;
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunkImpl(const ChunkSettings& chunkSettings,
+                                                                        ChunkMagazine* const chunkMagazine) noexcept
+{
+    void* chunk{nullptr};
+    MemPool* memPoolPointer{nullptr};
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize() + m_embeddedChunkManagementSize;
+
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = findMemPoolIndex(requiredChunkSize);
+    if (m_hasBuddyMemPool)
+    {
+        if (requiredChunkSize <= m_memPoolVector.front().getMaxChunkSize())
+        {
+            memPoolPointer = &m_memPoolVector.front();
+            chunk = memPoolPointer->getChunk(requiredChunkSize);
+        }
+    }
+    else if (memPoolIndex < numberOfMemPools)
+    {
+        const auto preferredMemPoolIndex =
+            m_hasNumaLocalMemPools ? findNumaLocalMemPoolIndex(memPoolIndex) : memPoolIndex;
+        memPoolPointer = &m_memPoolVector[preferredMemPoolIndex];
+        chunk = getChunkFromMemPool(*memPoolPointer, chunkMagazine);
+
+        // the mempools with the same chunk size on the other NUMA nodes are used before any larger mempool
+        const auto chunkSize = memPoolPointer->getChunkSize();
+        const auto firstMemPoolIndexWithChunkSize = memPoolIndex;
+        for (; chunk == nullptr && memPoolIndex < numberOfMemPools
+               && m_memPoolVector[memPoolIndex].getChunkSize() == chunkSize;
+             ++memPoolIndex)
+        {
+            if (memPoolIndex != preferredMemPoolIndex)
+            {
+                memPoolPointer = &m_memPoolVector[memPoolIndex];
+                chunk = getChunkFromMemPool(*memPoolPointer, chunkMagazine);
+            }
+        }
+
+        // the overflow chunks of the best fitting mempools are used before any larger mempool
+        if (chunk == nullptr)
+        {
+            memPoolPointer = &m_memPoolVector[preferredMemPoolIndex];
+            chunk = memPoolPointer->getOverflowChunk();
+        }
+        for (auto index = firstMemPoolIndexWithChunkSize; chunk == nullptr && index < memPoolIndex; ++index)
+        {
+            if (index != preferredMemPoolIndex)
+            {
+                memPoolPointer = &m_memPoolVector[index];
+                chunk = memPoolPointer->getOverflowChunk();
+            }
+        }
+
+        if (m_fallbackToLargerMemPool)
+        {
+            for (; chunk == nullptr && memPoolIndex < numberOfMemPools; ++memPoolIndex)
+            {
+                memPoolPointer = &m_memPoolVector[memPoolIndex];
+                chunk = getChunkFromMemPool(*memPoolPointer, chunkMagazine);
+            }
+        }
     }
 
     if (m_memPoolVector.size() == 0)
@@ -199,13 +577,41 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     }
     else
     {
-        auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
-        return ok(SharedChunk(chunkManagement));
+        void* chunkManagementMemory{nullptr};
+        if (m_embeddedChunkManagementSize == 0U)
+        {
+            auto& chunkManagementPool = m_chunkManagementPool.front();
+            chunkManagementMemory = (chunkMagazine != nullptr) ? chunkMagazine->getChunkManagement(chunkManagementPool)
+                                                               : chunkManagementPool.getChunk();
+        }
+        return ok(constructChunk(chunk,
+                                 *memPoolPointer,
+                                 memPoolPointer->getChunkSizeFor(requiredChunkSize),
+                                 chunkSettings,
+                                 chunkManagementMemory));
     }
 }
 
+SharedChunk MemoryManager::constructChunk(void* const chunk,
+                                          MemPool& memPool,
+                                          const uint64_t chunkSize,
+                                          const ChunkSettings& chunkSettings,
+                                          void* const chunkManagementMemory) noexcept
+{
+    if (m_embeddedChunkManagementSize > 0U)
+    {
+        // the ChunkManagement occupies the reserved space at the start of the chunk and is followed by the ChunkHeader;
+        // this saves the operations on the chunk management pool and keeps the reference counter close to the header
+        auto chunkHeader = new (static_cast<uint8_t*>(chunk) + m_embeddedChunkManagementSize)
+            ChunkHeader(chunkSize - m_embeddedChunkManagementSize, chunkSettings);
+        return SharedChunk(new (chunk) ChunkManagement(chunkHeader, &memPool));
+    }
+
+    auto chunkHeader = new (chunk) ChunkHeader(chunkSize, chunkSettings);
+    return SharedChunk(
+        new (chunkManagementMemory) ChunkManagement(chunkHeader, &memPool, &m_chunkManagementPool.front()));
+}
+
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
 {
     stream << asStringLiteral(value);
@@ -23,6 +23,15 @@ namespace iox
 {
 namespace mepoo
 {
+namespace
+{
+/// @brief orders the mempools without a NUMA node before the ones with a NUMA node
+uint64_t numaNodeOrder(const optional<uint32_t>& numaNode) noexcept
+{
+    return numaNode.has_value() ? static_cast<uint64_t>(numaNode.value()) + 1U : 0U;
+}
+} // namespace
+
 const MePooConfig::MePooConfigContainerType* MePooConfig::getMemPoolConfig() const noexcept
 {
     return &m_mempoolConfig;
@@ -60,24 +69,27 @@ MePooConfig& MePooConfig::optimize() noexcept
     auto config = m_mempoolConfig;
     m_mempoolConfig.clear();
 
-    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.m_size < rhs.m_size; });
+    // mempools with the same size but different NUMA nodes are kept apart and ordered by the NUMA node
+    std::sort(config.begin(), config.end(), [](const Entry& lhs, const Entry& rhs) {
+        return (lhs.m_size < rhs.m_size) || (lhs.m_size == rhs.m_size && numaNodeOrder(lhs.m_numaNode) < numaNodeOrder(rhs.m_numaNode));
+    });
 
     MePooConfig::Entry newEntry{0u, 0u};
 
     for (const auto& entry : config)
     {
-        if (entry.m_size != newEntry.m_size)
+        if (entry.m_size != newEntry.m_size || entry.m_numaNode != newEntry.m_numaNode)
         {
             if (newEntry.m_size != 0u)
             {
                 m_mempoolConfig.push_back(newEntry);
             }
-            newEntry.m_size = entry.m_size;
-            newEntry.m_chunkCount = entry.m_chunkCount;
+            newEntry = entry;
         }
         else
         {
             newEntry.m_chunkCount += entry.m_chunkCount;
+            newEntry.m_overflowChunkCount += entry.m_overflowChunkCount;
         }
     }
 
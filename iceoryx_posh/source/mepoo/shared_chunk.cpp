@@ -60,8 +60,16 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    if (m_chunkManagement->isEmbeddedInChunk())
+    {
+        // the embedded ChunkManagement is located at the start of the chunk and released together with it
+        m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement));
+    }
+    else
+    {
+        m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
+        m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    }
     m_chunkManagement = nullptr;
 }
 
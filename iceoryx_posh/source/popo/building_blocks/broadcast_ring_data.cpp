@@ -0,0 +1,38 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/assertions.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+BroadcastRingData::BroadcastRingData(const uint64_t capacity) noexcept
+    : m_capacity(algorithm::minVal(capacity, MAX_BROADCAST_RING_CAPACITY))
+{
+    IOX_ENFORCE(m_capacity > 0U, "The capacity of the broadcast ring must not be zero!");
+    if (m_capacity != capacity)
+    {
+        IOX_LOG(Warn, "Broadcast ring too large, reducing from " << capacity << " to " << m_capacity);
+    }
+}
+
+} // namespace popo
+} // namespace iox
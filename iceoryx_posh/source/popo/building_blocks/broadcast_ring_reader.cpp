@@ -0,0 +1,168 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_reader.hpp"
+#include "iox/algorithm.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace popo
+{
+BroadcastRingReader::BroadcastRingReader(not_null<MemberType_t* const> cursorDataPtr) noexcept
+    : m_cursorDataPtr(cursorDataPtr)
+{
+}
+
+const BroadcastRingReader::MemberType_t* BroadcastRingReader::getMembers() const noexcept
+{
+    return m_cursorDataPtr;
+}
+
+BroadcastRingReader::MemberType_t* BroadcastRingReader::getMembers() noexcept
+{
+    return m_cursorDataPtr;
+}
+
+optional<mepoo::SharedChunk> BroadcastRingReader::tryPop() noexcept
+{
+    auto* broadcastRing = enterBroadcastRing();
+    if (broadcastRing == nullptr)
+    {
+        return nullopt;
+    }
+
+    optional<mepoo::SharedChunk> chunk;
+    auto& nextSequenceNumber = getMembers()->m_nextSequenceNumber;
+    while (!chunk.has_value())
+    {
+        const auto latestSequenceNumber = broadcastRing->m_nextSequenceNumber.load(std::memory_order_acquire);
+        if (nextSequenceNumber >= latestSequenceNumber)
+        {
+            break;
+        }
+
+        // the writer overtook the cursor; the chunks older than the capacity are already overwritten
+        if (latestSequenceNumber - nextSequenceNumber > broadcastRing->m_capacity)
+        {
+            nextSequenceNumber = latestSequenceNumber - broadcastRing->m_capacity;
+            getMembers()->m_hasLostChunks.store(true, std::memory_order_relaxed);
+        }
+
+        const auto sequenceNumber = nextSequenceNumber;
+        ++nextSequenceNumber;
+        auto& slot = broadcastRing->m_slots[sequenceNumber % broadcastRing->m_capacity];
+        if (slot.m_sequenceNumber.load(std::memory_order_acquire) != sequenceNumber)
+        {
+            getMembers()->m_hasLostChunks.store(true, std::memory_order_relaxed);
+            continue;
+        }
+
+        // the clone fails if the writer released the chunk in the meantime; if the memory of the chunk was already
+        // reused for another chunk, the sequence number check after the fence detects this and the clone is dropped
+        auto clonedChunk = slot.m_chunk.load(std::memory_order_relaxed).tryCloneToSharedChunk();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!clonedChunk || slot.m_sequenceNumber.load(std::memory_order_relaxed) != sequenceNumber)
+        {
+            getMembers()->m_hasLostChunks.store(true, std::memory_order_relaxed);
+            continue;
+        }
+
+        chunk.emplace(clonedChunk);
+    }
+
+    leaveBroadcastRing();
+    return chunk;
+}
+
+bool BroadcastRingReader::hasLostChunks() noexcept
+{
+    if (getMembers()->m_hasLostChunks.load(std::memory_order_relaxed))
+    {
+        getMembers()->m_hasLostChunks.store(false, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool BroadcastRingReader::empty() const noexcept
+{
+    return size() == 0U;
+}
+
+uint64_t BroadcastRingReader::size() const noexcept
+{
+    const auto* broadcastRing = enterBroadcastRing();
+    if (broadcastRing == nullptr)
+    {
+        return 0U;
+    }
+
+    const auto latestSequenceNumber = broadcastRing->m_nextSequenceNumber.load(std::memory_order_acquire);
+    const auto nextSequenceNumber = getMembers()->m_nextSequenceNumber;
+    const uint64_t numberOfUnreadChunks = (latestSequenceNumber > nextSequenceNumber)
+                                              ? algorithm::minVal(latestSequenceNumber - nextSequenceNumber,
+                                                                  broadcastRing->m_capacity)
+                                              : 0U;
+
+    leaveBroadcastRing();
+    return numberOfUnreadChunks;
+}
+
+void BroadcastRingReader::clear() noexcept
+{
+    const auto* broadcastRing = enterBroadcastRing();
+    if (broadcastRing == nullptr)
+    {
+        return;
+    }
+
+    getMembers()->m_nextSequenceNumber = broadcastRing->m_nextSequenceNumber.load(std::memory_order_acquire);
+
+    leaveBroadcastRing();
+}
+
+BroadcastRingData* BroadcastRingReader::enterBroadcastRing() const noexcept
+{
+    // fast path for the common case of a receiver without a ring
+    if (getMembers()->m_attachedBroadcastRingId.load(std::memory_order_relaxed)
+        == BroadcastRingCursorData::NO_BROADCAST_RING)
+    {
+        return nullptr;
+    }
+
+    // the use is announced before the attachment is checked again; with the sequentially consistent ordering either
+    // RouDi sees the announcement when it detaches the cursor or the receiver sees the detachment
+    getMembers()->m_isInUse.store(true, std::memory_order_seq_cst);
+    if (getMembers()->m_attachedBroadcastRingId.load(std::memory_order_seq_cst)
+        == BroadcastRingCursorData::NO_BROADCAST_RING)
+    {
+        leaveBroadcastRing();
+        return nullptr;
+    }
+
+    return m_cursorDataPtr->m_broadcastRing.get();
+}
+
+void BroadcastRingReader::leaveBroadcastRing() const noexcept
+{
+    getMembers()->m_isInUse.store(false, std::memory_order_release);
+}
+
+} // namespace popo
+} // namespace iox
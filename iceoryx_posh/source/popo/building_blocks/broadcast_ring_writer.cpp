@@ -0,0 +1,133 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_writer.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/detail/adaptive_wait.hpp"
+#include "iox/logging.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace popo
+{
+BroadcastRingWriter::BroadcastRingWriter(not_null<MemberType_t* const> broadcastRingDataPtr) noexcept
+    : m_broadcastRingDataPtr(broadcastRingDataPtr)
+{
+}
+
+const BroadcastRingWriter::MemberType_t* BroadcastRingWriter::getMembers() const noexcept
+{
+    return m_broadcastRingDataPtr;
+}
+
+BroadcastRingWriter::MemberType_t* BroadcastRingWriter::getMembers() noexcept
+{
+    return m_broadcastRingDataPtr;
+}
+
+void BroadcastRingWriter::push(mepoo::SharedChunk chunk) noexcept
+{
+    const auto sequenceNumber = getMembers()->m_nextSequenceNumber.load(std::memory_order_relaxed);
+    auto& slot = getMembers()->m_slots[sequenceNumber % getMembers()->m_capacity];
+
+    // the slot is invalidated before the previous chunk is replaced; a reader which cloned the previous chunk
+    // concurrently either keeps it alive with its reference or sees the invalidation when it checks the sequence number
+    // after the clone
+    slot.m_sequenceNumber.store(BroadcastRingData::INVALID_SEQUENCE_NUMBER, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto previousChunk = slot.m_chunk.exchange(mepoo::ShmSafeUnmanagedChunk(chunk), std::memory_order_relaxed);
+    slot.m_sequenceNumber.store(sequenceNumber, std::memory_order_release);
+    getMembers()->m_nextSequenceNumber.store(sequenceNumber + 1U, std::memory_order_release);
+
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
+    // side effect here and return value does not need to be evaluated
+    previousChunk.releaseToSharedChunk();
+}
+
+void BroadcastRingWriter::releaseAll() noexcept
+{
+    for (uint64_t i = 0U; i < getMembers()->m_capacity; ++i)
+    {
+        auto& slot = getMembers()->m_slots[i];
+        slot.m_sequenceNumber.store(BroadcastRingData::INVALID_SEQUENCE_NUMBER, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
+        // side effect here and return value does not need to be evaluated
+        slot.m_chunk.exchange(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_relaxed).releaseToSharedChunk();
+    }
+}
+
+bool BroadcastRingWriter::attach(BroadcastRingCursorData& cursor, const uint64_t numberOfHistoryChunks) noexcept
+{
+    if (cursor.m_attachedBroadcastRingId.load(std::memory_order_relaxed) != BroadcastRingCursorData::NO_BROADCAST_RING
+        || numberOfHistoryChunks > getMembers()->m_capacity)
+    {
+        return false;
+    }
+
+    const auto nextSequenceNumber = getMembers()->m_nextSequenceNumber.load(std::memory_order_acquire);
+    cursor.m_broadcastRing = getMembers();
+    cursor.m_nextSequenceNumber = nextSequenceNumber - algorithm::minVal(numberOfHistoryChunks, nextSequenceNumber);
+    cursor.m_hasLostChunks.store(false, std::memory_order_relaxed);
+    cursor.m_attachedBroadcastRingId.store(static_cast<UniqueId::value_type>(getMembers()->m_uniqueId),
+                                           std::memory_order_seq_cst);
+
+    return true;
+}
+
+void BroadcastRingWriter::detach(BroadcastRingCursorData& cursor) noexcept
+{
+    if (!isAttached(cursor))
+    {
+        return;
+    }
+
+    cursor.m_attachedBroadcastRingId.store(BroadcastRingCursorData::NO_BROADCAST_RING, std::memory_order_seq_cst);
+
+    // grace period; the cursor might be attached to another ring after this call, therefore the receiver must not use
+    // this ring anymore
+    deadline_timer gracePeriod{READER_GRACE_PERIOD};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (cursor.m_isInUse.load(std::memory_order_seq_cst))
+    {
+        if (gracePeriod.hasExpired())
+        {
+            IOX_LOG(Warn,
+                    "The receiver did not leave the broadcast ring within the grace period! It is assumed that the "
+                    "receiver was terminated while reading a chunk.");
+            break;
+        }
+        adaptiveWait.wait();
+    }
+}
+
+bool BroadcastRingWriter::isAttached(const BroadcastRingCursorData& cursor) const noexcept
+{
+    return cursor.m_attachedBroadcastRingId.load(std::memory_order_relaxed)
+           == static_cast<UniqueId::value_type>(getMembers()->m_uniqueId);
+}
+
+uint64_t BroadcastRingWriter::getCapacity() const noexcept
+{
+    return getMembers()->m_capacity;
+}
+
+} // namespace popo
+} // namespace iox
@@ -18,6 +18,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 
+#include <cerrno>
+
 namespace iox
 {
 namespace popo
@@ -46,8 +48,20 @@ void ConditionListener::resetSemaphore() noexcept
 void ConditionListener::destroy() volatile noexcept
 {
     m_toBeDestroyed.store(true, std::memory_order_relaxed);
-    getMembers()->m_semaphore->post().or_else(
-        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY); });
+    if constexpr (IOX_FUTEX_AVAILABLE)
+    {
+        // the release ordering makes the destroy flag visible to a listener which reads the new generation
+        getMembers()->m_wakeUpGeneration.fetch_add(1U, std::memory_order_release);
+        if (iox_futex_wake(getMembers()->futexWord(), 1U) == -1)
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_FUTEX_FAILED_IN_DESTROY);
+        }
+    }
+    else
+    {
+        getMembers()->m_semaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY); });
+    }
 }
 
 bool ConditionListener::wasNotified() const noexcept
@@ -57,8 +71,17 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
+    return waitImpl([this](const uint32_t wakeUpGeneration) -> bool {
+        if constexpr (IOX_FUTEX_AVAILABLE)
+        {
+            if (iox_futex_wait(this->getMembers()->futexWord(), wakeUpGeneration, nullptr) == -1 && errno != EAGAIN
+                && errno != EINTR)
+            {
+                IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_FUTEX_FAILED_IN_WAIT);
+                return false;
+            }
+        }
+        else if (this->getMembers()->m_semaphore->wait().has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT);
             return false;
@@ -69,8 +92,17 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    return waitImpl([this, timeToWait](const uint32_t wakeUpGeneration) -> bool {
+        if constexpr (IOX_FUTEX_AVAILABLE)
+        {
+            const auto timeout = timeToWait.timespec();
+            if (iox_futex_wait(this->getMembers()->futexWord(), wakeUpGeneration, &timeout) == -1 && errno != EAGAIN
+                && errno != EINTR && errno != ETIMEDOUT)
+            {
+                IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_FUTEX_FAILED_IN_TIMED_WAIT);
+            }
+        }
+        else if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
         {
             IOX_REPORT_FATAL(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT);
         }
@@ -78,40 +110,76 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+ConditionListener::NotificationVector_t
+ConditionListener::waitImpl(const function_ref<bool(const uint32_t)> waitCall) noexcept
 {
     using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
-    resetSemaphore();
-    bool doReturnAfterNotificationCollection = false;
-    while (!m_toBeDestroyed.load(std::memory_order_relaxed))
-    {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+    // only the words whose bit is set in the summary are visited; iterating over the words and bits in ascending
+    // order results in a sorted vector
+    auto collectNotifications = [&] {
+        auto activeWords = getMembers()->m_activeNotificationWords.exchange(0U, std::memory_order_acquire);
+        while (activeWords != 0U)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            const auto wordIndex = countTrailingZeros(activeWords);
+            activeWords &= activeWords - 1U;
+
+            auto activeBits = getMembers()->m_activeNotifications[wordIndex].exchange(0U, std::memory_order_acquire);
+            while (activeBits != 0U)
             {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
+                activeNotifications.emplace_back(static_cast<Type_t>(
+                    wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD + countTrailingZeros(activeBits)));
+                activeBits &= activeBits - 1U;
             }
         }
+
+        if (!activeNotifications.empty())
+        {
+            getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+        }
+    };
+
+    if constexpr (!IOX_FUTEX_AVAILABLE)
+    {
+        resetSemaphore();
+    }
+
+    bool doReturnAfterNotificationCollection = false;
+    while (true)
+    {
+        // the generation is read before the destroy flag is checked and the notifications are collected; a destroy
+        // or a wake-up after this point changes the generation and the futex does not block
+        const auto wakeUpGeneration = getMembers()->m_wakeUpGeneration.load(std::memory_order_acquire);
+        if (m_toBeDestroyed.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        collectNotifications();
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        // the notifiers wake up the listener only when it announced that it waits; the notifications are collected
+        // once more after the announcement since a notifier could have missed it
+        getMembers()->m_isListenerWaiting.store(true, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        collectNotifications();
+        if (!activeNotifications.empty())
+        {
+            getMembers()->m_isListenerWaiting.store(false, std::memory_order_relaxed);
+            return activeNotifications;
+        }
+
+        doReturnAfterNotificationCollection = !waitCall(wakeUpGeneration);
+        getMembers()->m_isListenerWaiting.store(false, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
-{
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
-}
-
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
 {
     return m_condVarDataPtr;
@@ -38,10 +38,40 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    const auto wordIndex = m_notificationIndex / ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    const auto bitIndex = m_notificationIndex % ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    getMembers()->m_activeNotifications[wordIndex].fetch_or(1ULL << bitIndex, std::memory_order_release);
+    getMembers()->m_activeNotificationWords.fetch_or(1ULL << wordIndex, std::memory_order_release);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
-    getMembers()->m_semaphore->post().or_else(
-        [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+
+    // pairs with the fence in ConditionListener::waitImpl; either the listener sees the notification when it
+    // collects the notifications for the last time before it blocks or the notifier sees that the listener waits
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // the load avoids the read-modify-write as long as the listener is busy; of all the notifiers which see the
+    // waiting listener only the one which resets the flag has to post
+    if (getMembers()->m_isListenerWaiting.load(std::memory_order_relaxed)
+        && getMembers()->m_isListenerWaiting.exchange(false, std::memory_order_acquire))
+    {
+        wakeUpListener();
+    }
+}
+
+void ConditionNotifier::wakeUpListener() noexcept
+{
+    if constexpr (IOX_FUTEX_AVAILABLE)
+    {
+        getMembers()->m_wakeUpGeneration.fetch_add(1U, std::memory_order_release);
+        if (iox_futex_wake(getMembers()->futexWord(), 1U) == -1)
+        {
+            IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_FUTEX_FAILED_IN_NOTIFY);
+        }
+    }
+    else
+    {
+        getMembers()->m_semaphore->post().or_else(
+            [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY); });
+    }
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
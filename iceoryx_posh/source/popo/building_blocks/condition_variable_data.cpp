@@ -30,16 +30,32 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
-    build::InterProcessSemaphore::Builder()
-        .initialValue(0U)
-        .isInterProcessCapable(true)
-        .create(m_semaphore)
-        .or_else([](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
+    if constexpr (!IOX_FUTEX_AVAILABLE)
+    {
+        build::InterProcessSemaphore::Builder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_semaphore)
+            .or_else(
+                [](auto) { IOX_REPORT_FATAL(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE); });
+    }
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    const auto word = m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed);
+    return (word & (1ULL << (index % NOTIFICATIONS_PER_WORD))) != 0U;
+}
+
+uint32_t* ConditionVariableData::futexWord() noexcept
+{
+    static_assert(sizeof(m_wakeUpGeneration) == sizeof(uint32_t), "The futex word must be a plain 32 bit word");
+    return reinterpret_cast<uint32_t*>(&m_wakeUpGeneration);
+}
 } // namespace popo
 } // namespace iox
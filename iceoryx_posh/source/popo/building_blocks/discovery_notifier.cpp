@@ -0,0 +1,47 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iox/assertions.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryNotifier::DiscoveryNotifier(DiscoveryNotificationData& discoveryNotificationData,
+                                     const uint64_t portIndex) noexcept
+    : m_discoveryNotificationDataPtr(&discoveryNotificationData)
+    , m_portIndex(portIndex)
+{
+    IOX_ENFORCE(portIndex < DiscoveryNotificationData::NUMBER_OF_PORTS, "The port index is out of range!");
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    const auto wordIndex = m_portIndex / DiscoveryNotificationData::PORTS_PER_WORD;
+    const auto bitIndex = m_portIndex % DiscoveryNotificationData::PORTS_PER_WORD;
+    // the release pairs with the acquire of the discovery loop when it takes the changed ports; it therefore sees the
+    // CaPro state which was requested before the notification
+    m_discoveryNotificationDataPtr->m_changedPorts[wordIndex].fetch_or(1ULL << bitIndex, std::memory_order_release);
+
+    ConditionNotifier(m_discoveryNotificationDataPtr->m_conditionVariableData,
+                      DiscoveryNotificationData::PORT_NOTIFICATION_INDEX)
+        .notify();
+}
+
+} // namespace popo
+} // namespace iox
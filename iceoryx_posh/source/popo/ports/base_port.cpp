@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 
 namespace iox
 {
@@ -64,6 +65,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -71,5 +73,14 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    auto* discoveryNotificationData = getMembers()->m_discoveryNotificationData.get();
+    if (discoveryNotificationData != nullptr)
+    {
+        DiscoveryNotifier(*discoveryNotificationData, getMembers()->m_discoveryNotificationIndex).notify();
+    }
+}
+
 } // namespace popo
 } // namespace iox
@@ -28,11 +28,19 @@ PublisherPortData::PublisherPortData(const capro::ServiceDescription& serviceDes
                                      const PublisherOptions& publisherOptions,
                                      const mepoo::MemoryInfo& memoryInfo) noexcept
     : BasePortData(serviceDescription, runtimeName, uniqueRouDiId)
-    , m_chunkSenderData(
-          memoryManager, publisherOptions.subscriberTooSlowPolicy, publisherOptions.historyCapacity, memoryInfo)
+    , m_chunkSenderData(memoryManager,
+                        publisherOptions.subscriberTooSlowPolicy,
+                        publisherOptions.historyCapacity,
+                        memoryInfo,
+                        publisherOptions.useChunkMagazine)
     , m_options{publisherOptions}
     , m_offeringRequested(publisherOptions.offerOnCreate)
 {
+    if (publisherOptions.broadcastRingCapacity > 0U)
+    {
+        m_broadcastRing.emplace(publisherOptions.broadcastRingCapacity);
+        m_chunkSenderData.m_broadcastRing = &m_broadcastRing.value();
+    }
 }
 
 } // namespace popo
@@ -48,6 +48,22 @@ PublisherPortUser::tryAllocateChunk(const uint64_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<void, AllocationError> PublisherPortUser::tryAllocateChunks(mepoo::ChunkHeader** const chunkHeaders,
+                                                                     const uint32_t numberOfChunks,
+                                                                     const uint64_t userPayloadSize,
+                                                                     const uint32_t userPayloadAlignment,
+                                                                     const uint32_t userHeaderSize,
+                                                                     const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateBatch(getUniqueID(),
+                                          userPayloadSize,
+                                          userPayloadAlignment,
+                                          userHeaderSize,
+                                          userHeaderAlignment,
+                                          chunkHeaders,
+                                          numberOfChunks);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +87,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // see 'sendChunk' why the chunks are put in the history when the publisher port is not offered
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +115,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -89,6 +124,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -102,5 +138,13 @@ bool PublisherPortUser::hasSubscribers() const noexcept
     return m_chunkSender.hasStoredQueues();
 }
 
+void PublisherPortUser::notifySubscribers() noexcept
+{
+    if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
+    {
+        m_chunkSender.notifyAllStoredQueues();
+    }
+}
+
 } // namespace popo
 } // namespace iox
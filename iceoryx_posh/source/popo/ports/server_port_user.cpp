@@ -56,6 +56,31 @@ expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest()
     return ok(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));
 }
 
+expected<uint32_t, ServerRequestResult> ServerPortUser::getRequests(const RequestHeader** const requestHeaders,
+                                                                    const uint32_t maxNumberOfRequests) noexcept
+{
+    const mepoo::ChunkHeader* chunkHeaders[ServerChunkReceiverData_t::MAX_CHUNKS_IN_USE];
+    auto getChunksResult = m_chunkReceiver.tryGetBatch(
+        &chunkHeaders[0], algorithm::minVal(maxNumberOfRequests, ServerChunkReceiverData_t::MAX_CHUNKS_IN_USE));
+
+    if (getChunksResult.has_error())
+    {
+        if (!isOffered())
+        {
+            return err(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER);
+        }
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return err(into<ServerRequestResult>(getChunksResult.error()));
+    }
+
+    const auto numberOfRequests = getChunksResult.value();
+    for (uint32_t i = 0U; i < numberOfRequests; ++i)
+    {
+        requestHeaders[i] = static_cast<const RequestHeader*>(chunkHeaders[i]->userHeader());
+    }
+    return ok(numberOfRequests);
+}
+
 void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
     if (requestHeader != nullptr)
@@ -163,6 +188,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -171,6 +197,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -68,6 +70,12 @@ expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryG
     return m_chunkReceiver.tryGet();
 }
 
+expected<uint32_t, ChunkReceiveResult> SubscriberPortUser::tryGetChunks(const mepoo::ChunkHeader** const chunkHeaders,
+                                                                        const uint32_t maxNumberOfChunks) noexcept
+{
+    return m_chunkReceiver.tryGetBatch(chunkHeaders, maxNumberOfChunks);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
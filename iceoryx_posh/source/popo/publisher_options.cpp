@@ -26,7 +26,9 @@ Serialization PublisherOptions::serialize() const noexcept
     return Serialization::create(historyCapacity,
                                  nodeName,
                                  offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+                                 useChunkMagazine,
+                                 broadcastRingCapacity);
 }
 
 expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
@@ -39,7 +41,9 @@ expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(c
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.useChunkMagazine,
+                                                        publisherOptions.broadcastRingCapacity);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -52,6 +52,8 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(Trace, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
         IOX_LOG(Trace, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
         IOX_LOG(Trace, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
+        IOX_LOG(Trace, "  Memory Prefault Mode = " << roudiConfig.memoryPrefaultMode);
+        IOX_LOG(Trace, "  Memory Prefault Thread Count = " << roudiConfig.memoryPrefaultThreadCount);
     }
 }
 
@@ -32,5 +32,11 @@ optional<void*> MemoryBlock::memory() const noexcept
     return m_memory ? make_optional<void*>(m_memory) : nullopt_t();
 }
 
+void MemoryBlock::forEachAdditionalMemory(const function_ref<void(void*, uint64_t)> callable
+                                          [[maybe_unused]]) const noexcept
+{
+    // nothing to do in the default implementation
+}
+
 } // namespace roudi
 } // namespace iox
@@ -72,5 +72,14 @@ optional<mepoo::SegmentManager<>*> MemPoolSegmentManagerMemoryBlock::segmentMana
     return m_segmentManager ? make_optional<mepoo::SegmentManager<>*>(m_segmentManager) : nullopt_t();
 }
 
+void MemPoolSegmentManagerMemoryBlock::forEachAdditionalMemory(
+    const function_ref<void(void*, uint64_t)> callable) const noexcept
+{
+    if (m_segmentManager != nullptr)
+    {
+        m_segmentManager->forEachSegmentMemory(callable);
+    }
+}
+
 } // namespace roudi
 } // namespace iox
@@ -18,7 +18,15 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
+#include "iox/detail/posix_prefault.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
+#include "iox/thread.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 namespace iox
 {
@@ -47,6 +55,13 @@ iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const RouDiMemor
     return logstream;
 }
 
+RouDiMemoryManager::RouDiMemoryManager(const MemoryPrefaultMode prefaultMode,
+                                       const uint32_t prefaultThreadCount) noexcept
+    : m_prefaultMode(prefaultMode)
+    , m_prefaultThreadCount(std::min(std::max(prefaultThreadCount, 1U), MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS))
+{
+}
+
 RouDiMemoryManager::~RouDiMemoryManager() noexcept
 {
     destroyMemory().or_else([](auto) { IOX_LOG(Warn, "Failed to cleanup RouDiMemoryManager in destructor."); });
@@ -85,9 +100,105 @@ expected<void, RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMem
         memoryProvider->announceMemoryAvailable();
     }
 
+    if (m_prefaultMode != MemoryPrefaultMode::OFF)
+    {
+        prefaultMemory();
+    }
+
     return ok();
 }
 
+void RouDiMemoryManager::prefaultMemory() noexcept
+{
+    MemoryRanges_t memoryRanges;
+    uint64_t totalSize{0U};
+    auto addMemoryRange = [&](void* memory, uint64_t size) {
+        if (memory == nullptr || size == 0U)
+        {
+            return;
+        }
+        if (!memoryRanges.push_back(MemoryRange{memory, size}))
+        {
+            IOX_LOG(Warn, "Too many memory ranges! The memory at " << iox::log::hex(memory) << " is not faulted in!");
+            return;
+        }
+        totalSize += size;
+    };
+
+    for (auto memoryProvider : m_memoryProvider)
+    {
+        memoryProvider->baseAddress().and_then(
+            [&](auto baseAddress) { addMemoryRange(baseAddress, memoryProvider->size()); });
+        for (auto memoryBlock : memoryProvider->m_memoryBlocks)
+        {
+            memoryBlock->forEachAdditionalMemory(addMemoryRange);
+        }
+    }
+
+    // every thread gets a contiguous share of the concatenated memory ranges; the shares are aligned to the page size
+    // in order to touch each page only by one thread
+    const uint64_t pageSizeOfSystem = detail::pageSize();
+    const uint64_t numberOfPages = align(totalSize, pageSizeOfSystem) / pageSizeOfSystem;
+    const uint64_t threadCount =
+        std::max(std::min(static_cast<uint64_t>(m_prefaultThreadCount), numberOfPages), static_cast<uint64_t>(1U));
+    const uint64_t sizePerThread = align((totalSize + threadCount - 1U) / threadCount, pageSizeOfSystem);
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    vector<std::thread, MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS> threads;
+    for (uint64_t i = 1U; i < threadCount; ++i)
+    {
+        const uint64_t beginOffset = std::min(i * sizePerThread, totalSize);
+        const uint64_t endOffset = std::min(beginOffset + sizePerThread, totalSize);
+        threads.emplace_back([&memoryRanges, beginOffset, endOffset, prefaultMode = m_prefaultMode] {
+            setThreadName("MemoryPrefault");
+            prefaultMemoryRanges(memoryRanges, beginOffset, endOffset, prefaultMode);
+        });
+    }
+    // the current thread handles the first share
+    prefaultMemoryRanges(memoryRanges, 0U, std::min(sizePerThread, totalSize), m_prefaultMode);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+    IOX_LOG(Info,
+            "Faulted in " << totalSize << " bytes of memory"
+                          << ((m_prefaultMode == MemoryPrefaultMode::LOCK) ? " and locked it into RAM" : "") << " with "
+                          << threadCount << " threads in " << duration.count() << " ms");
+}
+
+void RouDiMemoryManager::prefaultMemoryRanges(const MemoryRanges_t& memoryRanges,
+                                              const uint64_t beginOffset,
+                                              const uint64_t endOffset,
+                                              const MemoryPrefaultMode prefaultMode) noexcept
+{
+    // the offsets are relative to the start of the concatenated memory ranges
+    uint64_t rangeOffset{0U};
+    for (const auto& range : memoryRanges)
+    {
+        const uint64_t begin = std::max(beginOffset, rangeOffset);
+        const uint64_t end = std::min(endOffset, rangeOffset + range.size);
+        if (begin < end)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is within the memory range
+            void* memory = static_cast<uint8_t*>(range.memory) + (begin - rangeOffset);
+            const uint64_t size = end - begin;
+
+            if (prefaultMode == MemoryPrefaultMode::LOCK)
+            {
+                detail::lockMemory(memory, size);
+            }
+            // the memory is not yet used by any application, therefore it is safe to write to it
+            detail::prefaultMemory(memory, size, AccessMode::ReadWrite);
+        }
+        rangeOffset += range.size;
+    }
+}
+
 expected<void, RouDiMemoryManagerError> RouDiMemoryManager::destroyMemory() noexcept
 {
     expected<void, RouDiMemoryManagerError> result = ok();
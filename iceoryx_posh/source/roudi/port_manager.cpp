@@ -118,6 +118,13 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    auto& discoveryNotificationData = m_portPool->getDiscoveryNotificationData();
+    for (uint64_t wordIndex = 0U; wordIndex < popo::DiscoveryNotificationData::NUMBER_OF_WORDS; ++wordIndex)
+    {
+        m_changedPorts[wordIndex] =
+            discoveryNotificationData.m_changedPorts[wordIndex].exchange(0U, std::memory_order_acquire);
+    }
+
     handlePublisherPorts();
 
     handleSubscriberPorts();
@@ -137,10 +144,7 @@ void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
     auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto port = publisherPorts.begin();
-    while (port != publisherPorts.end())
-    {
-        auto currentPort = port++;
+    forEachChangedPort(publisherPorts, popo::DiscoveryNotificationData::PUBLISHER_OFFSET, [this](auto currentPort) {
         PublisherPortRouDiType publisherPort(currentPort.to_ptr());
 
         doDiscoveryForPublisherPort(publisherPort);
@@ -150,7 +154,7 @@ void PortManager::handlePublisherPorts() noexcept
         {
             destroyPublisherPort(currentPort.to_ptr());
         }
-    }
+    });
 }
 
 void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept
@@ -186,10 +190,7 @@ void PortManager::handleSubscriberPorts() noexcept
 {
     // get requests for change of subscription state of subscribers
     auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
-    auto port = subscriberPorts.begin();
-    while (port != subscriberPorts.end())
-    {
-        auto currentPort = port++;
+    forEachChangedPort(subscriberPorts, popo::DiscoveryNotificationData::SUBSCRIBER_OFFSET, [this](auto currentPort) {
         SubscriberPortType subscriberPort(currentPort.to_ptr());
 
         doDiscoveryForSubscriberPort(subscriberPort);
@@ -199,7 +200,7 @@ void PortManager::handleSubscriberPorts() noexcept
         {
             destroySubscriberPort(currentPort.to_ptr());
         }
-    }
+    });
 }
 
 void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept
@@ -263,6 +264,7 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
                                                  << clientPortData->m_serviceDescription << "'");
 
     // delete client port from list after DISCONNECT was processed
+    removeFromPortIndex(m_portPool->getClientPortDataList(), m_clientPortIndex, clientPortData);
     m_portPool->removeClientPort(clientPortData);
 }
 
@@ -270,10 +272,7 @@ void PortManager::handleClientPorts() noexcept
 {
     // get requests for change of connection state of clients
     auto& clientPorts = m_portPool->getClientPortDataList();
-    auto port = clientPorts.begin();
-    while (port != clientPorts.end())
-    {
-        auto currentPort = port++;
+    forEachChangedPort(clientPorts, popo::DiscoveryNotificationData::CLIENT_OFFSET, [this](auto currentPort) {
         popo::ClientPortRouDi clientPort(*currentPort);
 
         doDiscoveryForClientPort(clientPort);
@@ -283,7 +282,7 @@ void PortManager::handleClientPorts() noexcept
         {
             destroyClientPort(currentPort.to_ptr());
         }
-    }
+    });
 }
 
 void PortManager::doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept
@@ -361,6 +360,7 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
                                                  << serverPortData->m_serviceDescription << "'");
 
     // delete server port from list after STOP_OFFER was processed
+    removeFromPortIndex(m_portPool->getServerPortDataList(), m_serverPortIndex, serverPortData);
     m_portPool->removeServerPort(serverPortData);
 }
 
@@ -368,10 +368,7 @@ void PortManager::handleServerPorts() noexcept
 {
     // get the changes of server port offer state
     auto& serverPorts = m_portPool->getServerPortDataList();
-    auto port = serverPorts.begin();
-    while (port != serverPorts.end())
-    {
-        auto currentPort = port++;
+    forEachChangedPort(serverPorts, popo::DiscoveryNotificationData::SERVER_OFFSET, [this](auto currentPort) {
         popo::ServerPortRouDi serverPort(*currentPort);
 
         doDiscoveryForServerPort(serverPort);
@@ -381,7 +378,7 @@ void PortManager::handleServerPorts() noexcept
         {
             destroyServerPort(currentPort.to_ptr());
         }
-    }
+    });
 }
 
 void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept
@@ -527,88 +524,94 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType publisherPort(&publisherPortData);
-
-        auto messageInterface = message.m_serviceDescription.getSourceInterface();
-        auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
-
-        // internal publisher receive all messages all other publishers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
-        if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
-        {
-            // iox-#1908
-            continue;
-        }
+    forEachPortWithService(
+        m_portPool->getPublisherPortDataList(),
+        m_publisherPortIndex,
+        subscriberSource.getCaProServiceDescription(),
+        [&](auto& publisherPortData) {
+            PublisherPortRouDiType publisherPort(&publisherPortData);
+
+            auto messageInterface = message.m_serviceDescription.getSourceInterface();
+            auto publisherInterface = publisherPort.getCaProServiceDescription().getSourceInterface();
+
+            // internal publisher receive all messages all other publishers receive only messages if
+            // they do not have the same interface otherwise we have cyclic connections in gateways
+            if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
+            {
+                // iox-#1908
+                return;
+            }
 
-        if (isCompatiblePubSub(publisherPort, subscriberSource))
-        {
-            auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
-            if (publisherResponse.has_value())
+            if (isCompatiblePubSub(publisherPort, subscriberSource))
             {
-                // send response to subscriber port
-                subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
-                    .and_then([](auto& response) {
-                        IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
-                        IOX_PANIC("Expected no response on ACK or NACK messages");
-                    });
-
-                m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+                auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
+                if (publisherResponse.has_value())
+                {
+                    // send response to subscriber port
+                    subscriberSource.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
+                        .and_then([](auto& response) {
+                            IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
+                            IOX_PANIC("Expected no response on ACK or NACK messages");
+                        });
+
+                    m_portIntrospection.reportMessage(publisherResponse.value(), subscriberSource.getUniqueID());
+                }
+                publisherFound = true;
             }
-            publisherFound = true;
-        }
-    }
+        });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
-        SubscriberPortType subscriberPort(&subscriberPortData);
-
-        auto messageInterface = message.m_serviceDescription.getSourceInterface();
-        auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
-
-        // internal subscriber receive all messages all other subscribers receive only messages if
-        // they do not have the same interface otherwise we have cyclic connections in gateways
-        if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
-        {
-            // iox-#1908
-            continue;
-        }
-
-        if (isCompatiblePubSub(publisherSource, subscriberPort))
-        {
-            auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
-
-            // if the subscribers react on the change, process it immediately on publisher side
-            if (subscriberResponse.has_value())
+    forEachPortWithService(
+        m_portPool->getSubscriberPortDataList(),
+        m_subscriberPortIndex,
+        publisherSource.getCaProServiceDescription(),
+        [&](auto& subscriberPortData) {
+            SubscriberPortType subscriberPort(&subscriberPortData);
+
+            auto messageInterface = message.m_serviceDescription.getSourceInterface();
+            auto subscriberInterface = subscriberPort.getCaProServiceDescription().getSourceInterface();
+
+            // internal subscriber receive all messages all other subscribers receive only messages if
+            // they do not have the same interface otherwise we have cyclic connections in gateways
+            if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
             {
-                // we only expect reaction on OFFER
-                IOX_ENFORCE(capro::CaproMessageType::OFFER == message.m_type, "Received wrong 'CaproMessageType'!");
+                // iox-#1908
+                return;
+            }
 
-                // inform introspection
-                m_portIntrospection.reportMessage(subscriberResponse.value());
+            if (isCompatiblePubSub(publisherSource, subscriberPort))
+            {
+                auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
-                auto publisherResponse =
-                    publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
-                if (publisherResponse.has_value())
+                // if the subscribers react on the change, process it immediately on publisher side
+                if (subscriberResponse.has_value())
                 {
-                    // sende responsee to subscriber port
-                    subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
-                        .and_then([](auto& response) {
-                            IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
-                            IOX_PANIC("Expected no response on ACK or NACK messages");
-                        });
+                    // we only expect reaction on OFFER
+                    IOX_ENFORCE(capro::CaproMessageType::OFFER == message.m_type, "Received wrong 'CaproMessageType'!");
 
-                    m_portIntrospection.reportMessage(publisherResponse.value());
+                    // inform introspection
+                    m_portIntrospection.reportMessage(subscriberResponse.value());
+
+                    auto publisherResponse =
+                        publisherSource.dispatchCaProMessageAndGetPossibleResponse(subscriberResponse.value());
+                    if (publisherResponse.has_value())
+                    {
+                        // sende responsee to subscriber port
+                        subscriberPort.dispatchCaProMessageAndGetPossibleResponse(publisherResponse.value())
+                            .and_then([](auto& response) {
+                                IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
+                                IOX_PANIC("Expected no response on ACK or NACK messages");
+                            });
+
+                        m_portIntrospection.reportMessage(publisherResponse.value());
+                    }
                 }
             }
-        }
-    }
+        });
 }
 
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
@@ -631,68 +634,75 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto& clientPortData : m_portPool->getClientPortDataList())
-    {
-        popo::ClientPortRouDi clientPort(clientPortData);
-        if (isCompatibleClientServer(serverSource, clientPort))
-        {
-            // send OFFER/STOP_OFFER to client
-            auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
-
-            // if the clients react on the change, process it immediately on server side
-            if (clientResponse.has_value())
+    forEachPortWithService(
+        m_portPool->getClientPortDataList(),
+        m_clientPortIndex,
+        serverSource.getCaProServiceDescription(),
+        [&](auto& clientPortData) {
+            popo::ClientPortRouDi clientPort(clientPortData);
+            if (isCompatibleClientServer(serverSource, clientPort))
             {
-                // we only expect reaction on CONNECT
-                IOX_ENFORCE(capro::CaproMessageType::CONNECT == clientResponse.value().m_type,
-                            "Received wrong 'CaproMessageType'!");
-
-                /// @todo iox-#518 inform port introspection about client
+                // send OFFER/STOP_OFFER to client
+                auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
-                // send CONNECT to server
-                auto serverResponse = serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
-                if (serverResponse.has_value())
+                // if the clients react on the change, process it immediately on server side
+                if (clientResponse.has_value())
                 {
-                    // send response to client port
-                    clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
-                        .and_then([](auto& response) {
-                            IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
-                            IOX_PANIC("Expected no response on ACK or NACK messages");
-                        });
+                    // we only expect reaction on CONNECT
+                    IOX_ENFORCE(capro::CaproMessageType::CONNECT == clientResponse.value().m_type,
+                                "Received wrong 'CaproMessageType'!");
+
+                    /// @todo iox-#518 inform port introspection about client
 
-                    /// @todo iox-#1128 inform port introspection about server
+                    // send CONNECT to server
+                    auto serverResponse =
+                        serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
+                    if (serverResponse.has_value())
+                    {
+                        // send response to client port
+                        clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
+                            .and_then([](auto& response) {
+                                IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
+                                IOX_PANIC("Expected no response on ACK or NACK messages");
+                            });
+
+                        /// @todo iox-#1128 inform port introspection about server
+                    }
                 }
             }
-        }
-    }
+        });
 }
 
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto& serverPortData : m_portPool->getServerPortDataList())
-    {
-        popo::ServerPortRouDi serverPort(serverPortData);
-        if (isCompatibleClientServer(serverPort, clientSource))
-        {
-            // send CONNECT/DISCONNECT to server
-            auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
-
-            // if the server react on the change, process it immediately on client side
-            if (serverResponse.has_value())
+    forEachPortWithService(
+        m_portPool->getServerPortDataList(),
+        m_serverPortIndex,
+        clientSource.getCaProServiceDescription(),
+        [&](auto& serverPortData) {
+            popo::ServerPortRouDi serverPort(serverPortData);
+            if (isCompatibleClientServer(serverPort, clientSource))
             {
-                // send response to client port
-                clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
-                    .and_then([](auto& response) {
-                        IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
-                        IOX_PANIC("Expected no response on ACK or NACK messages");
-                    });
-
-                /// @todo iox-#1128 inform port introspection about client
+                // send CONNECT/DISCONNECT to server
+                auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
+
+                // if the server react on the change, process it immediately on client side
+                if (serverResponse.has_value())
+                {
+                    // send response to client port
+                    clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
+                        .and_then([](auto& response) {
+                            IOX_LOG(Fatal, "Got response '" << response.m_type << "'");
+                            IOX_PANIC("Expected no response on ACK or NACK messages");
+                        });
+
+                    /// @todo iox-#1128 inform port introspection about client
+                }
+                serverFound = true;
             }
-            serverFound = true;
-        }
-    }
+        });
     return serverFound;
 }
 
@@ -858,6 +868,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
                                                     << "' and with service description '"
                                                     << publisherPortData->m_serviceDescription << "'");
     // delete publisher port from list after STOP_OFFER was processed
+    removeFromPortIndex(m_portPool->getPublisherPortDataList(), m_publisherPortIndex, publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 }
 
@@ -886,6 +897,7 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
                                                      << "' and with service description '"
                                                      << subscriberPortData->m_serviceDescription << "'");
     // delete subscriber port from list after UNSUB was processed
+    removeFromPortIndex(m_portPool->getSubscriberPortDataList(), m_subscriberPortIndex, subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
@@ -944,6 +956,7 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            addToPortIndex(m_portPool->getPublisherPortDataList(), m_publisherPortIndex, publisherPortData);
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -997,6 +1010,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            addToPortIndex(m_portPool->getSubscriberPortDataList(), m_subscriberPortIndex, subscriberPortData);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -1019,6 +1033,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
     return m_portPool
         ->addClientPort(service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto clientPortData) {
+            this->addToPortIndex(m_portPool->getClientPortDataList(), m_clientPortIndex, clientPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
@@ -1036,34 +1051,32 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
 {
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto port = serverPorts.begin();
-    while (port != serverPorts.end())
-    {
-        auto currentPort = port++;
-
-        if (service == currentPort->m_serviceDescription)
+    optional<RuntimeName_t> usedByProcess;
+    forEachPortWithService(m_portPool->getServerPortDataList(), m_serverPortIndex, service, [&](auto& serverPortData) {
+        if (serverPortData.m_toBeDestroyed)
         {
-            if (currentPort->m_toBeDestroyed)
-            {
-                destroyServerPort(currentPort.to_ptr());
-                continue;
-            }
-            IOX_LOG(Warn,
-                    "Process '"
-                        << runtimeName
-                        << "' violates the communication policy by requesting a ServerPort which is already used by '"
-                        << currentPort->m_runtimeName << "' with service '"
-                        << service.operator Serialization().toString() << "'.");
-            IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
-            return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            destroyServerPort(&serverPortData);
+            return;
         }
+        usedByProcess.emplace(serverPortData.m_runtimeName);
+    });
+    if (usedByProcess.has_value())
+    {
+        IOX_LOG(
+            Warn,
+            "Process '"
+                << runtimeName
+                << "' violates the communication policy by requesting a ServerPort which is already used by '"
+                << usedByProcess.value() << "' with service '" << service.operator Serialization().toString() << "'.");
+        IOX_REPORT(PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, iox::er::RUNTIME_ERROR);
+        return err(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
     }
 
     // we can create a new port
     return m_portPool
         ->addServerPort(service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo)
         .and_then([this](auto serverPortData) {
+            this->addToPortIndex(m_portPool->getServerPortDataList(), m_serverPortIndex, serverPortData);
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the waiting client if offer on create is desired
@@ -38,6 +38,38 @@ PortPoolData::CondVarContainer& PortPool::getConditionVariableDataList() noexcep
     return m_portPoolData->m_conditionVariableMembers;
 }
 
+popo::DiscoveryNotificationData& PortPool::getDiscoveryNotificationData() noexcept
+{
+    return m_portPoolData->m_discoveryNotificationData;
+}
+
+void PortPool::attachToDiscoveryNotification(popo::BasePortData& portData, const uint64_t portIndex) noexcept
+{
+    portData.m_discoveryNotificationData = &m_portPoolData->m_discoveryNotificationData;
+    portData.m_discoveryNotificationIndex = portIndex;
+}
+
+void PortPool::detachPortsFromDiscoveryNotification() noexcept
+{
+    const auto detach = [](popo::BasePortData& portData) { portData.m_discoveryNotificationData = nullptr; };
+    for (auto& port : getPublisherPortDataList())
+    {
+        detach(port);
+    }
+    for (auto& port : getSubscriberPortDataList())
+    {
+        detach(port);
+    }
+    for (auto& port : getServerPortDataList())
+    {
+        detach(port);
+    }
+    for (auto& port : getClientPortDataList())
+    {
+        detach(port);
+    }
+}
+
 expected<popo::InterfacePortData*, PortPoolError>
 PortPool::addInterfacePort(const RuntimeName_t& runtimeName, const capro::Interfaces commInterface) noexcept
 {
@@ -102,6 +134,8 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotification(*publisherPortData,
+                                  popo::DiscoveryNotificationData::PUBLISHER_OFFSET + publisherPortData.to_index());
     return ok(publisherPortData.to_ptr());
 }
 
@@ -121,6 +155,9 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotification(*subscriberPortData,
+                                  popo::DiscoveryNotificationData::SUBSCRIBER_OFFSET
+                                      + getSubscriberPortDataList().iter_from_ptr(subscriberPortData).to_index());
     return ok(subscriberPortData);
 }
 
@@ -151,6 +188,8 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotification(*clientPortData,
+                                  popo::DiscoveryNotificationData::CLIENT_OFFSET + clientPortData.to_index());
     return ok(clientPortData.to_ptr());
 }
 
@@ -171,6 +210,8 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         IOX_REPORT(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, iox::er::RUNTIME_ERROR);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    attachToDiscoveryNotification(*serverPortData,
+                                  popo::DiscoveryNotificationData::SERVER_OFFSET + serverPortData.to_index());
     return ok(serverPortData.to_ptr());
 }
 
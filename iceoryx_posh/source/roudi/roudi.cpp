@@ -17,8 +17,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/detail/convert.hpp"
@@ -38,6 +39,7 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     : m_roudiConfig(roudiConfig)
     , m_runMonitoringAndDiscoveryThread(true)
     , m_runHandleRuntimeMessageThread(true)
+    , m_discoveryNotificationData(&roudiMemoryInterface.portPool().value()->getDiscoveryNotificationData())
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
     , m_prcMgr(concurrent::ForwardArgsToCTor,
@@ -96,7 +98,9 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    popo::ConditionNotifier(m_discoveryNotificationData->m_conditionVariableData,
+                            popo::DiscoveryNotificationData::TRIGGER_NOTIFICATION_INDEX)
+        .notify();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -111,6 +115,10 @@ void RouDi::shutdown() noexcept
         IOX_LOG(Debug, "...'Mon+Discover' thread joined.");
     }
 
+    // the ports which are destroyed from now on must not notify the stopped discovery loop
+    m_roudiMemoryInterface->portPool().and_then(
+        [](auto& portPool) { portPool->detachPortsFromDiscoveryNotification(); });
+
     if (!m_roudiConfig.sharesAddressSpaceWithApplications)
     {
         deadline_timer terminationDelayTimer(m_roudiConfig.processTerminationDelay);
@@ -189,7 +197,9 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    popo::ConditionNotifier(m_discoveryNotificationData->m_conditionVariableData,
+                            popo::DiscoveryNotificationData::TRIGGER_NOTIFICATION_INDEX)
+        .notify();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(Error,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -202,24 +212,19 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the loop wakes up when a port notifies a change of its CaPro state or when it is triggered manually; the
+    // timeout is only required for the monitoring of the processes and the ports which are still polled
+    popo::ConditionListener discoveryLoopListener{m_discoveryNotificationData->m_conditionVariableData};
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
     {
         m_prcMgr->run();
 
+        // the overflow chunks are not used while the memory is released, therefore no runtime has to be involved
+        m_roudiMemoryInterface->segmentManager().and_then(
+            [](auto& segmentManager) { segmentManager->releaseIdleOverflowMemory(); });
+
         cyclicUpdateHook();
 
         if (manuallyTriggered)
@@ -232,9 +237,9 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        for (const auto notificationIndex : discoveryLoopListener.timedWait(DISCOVERY_INTERVAL))
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex == popo::DiscoveryNotificationData::TRIGGER_NOTIFICATION_INDEX)
             {
                 manuallyTriggered = true;
                 break;
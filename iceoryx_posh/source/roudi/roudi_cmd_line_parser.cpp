@@ -39,10 +39,12 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"memory-prefault", required_argument, nullptr, 'p'},
+                                       {"memory-prefault-threads", required_argument, nullptr, 'j'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:p:j:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -92,6 +94,19 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-p, --memory-prefault <MODE>      Set how the shared memory is prepared at startup." << std::endl;
+            std::cout << "                                  <MODE> {off, on, lock}" << std::endl;
+            std::cout << "                                  default = 'off'" << std::endl;
+            std::cout << "                                  off: pages are faulted in on first access" << std::endl;
+            std::cout << "                                  on: all pages are faulted in at startup" << std::endl;
+            std::cout << "                                  lock: all pages are faulted in at startup and" << std::endl;
+            std::cout << "                                  locked into RAM" << std::endl;
+            std::cout << "-j, --memory-prefault-threads <UINT>" << std::endl;
+            std::cout << "                                  Set the number of threads which fault in the" << std::endl;
+            std::cout << "                                  shared memory at startup." << std::endl;
+            std::cout << "                                  <UINT> 1.." << roudi::MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS
+                      << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -220,6 +235,42 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'p':
+        {
+            if (strcmp(optarg, "off") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryPrefaultMode = roudi::MemoryPrefaultMode::OFF;
+            }
+            else if (strcmp(optarg, "on") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryPrefaultMode = roudi::MemoryPrefaultMode::PREFAULT;
+            }
+            else if (strcmp(optarg, "lock") == 0)
+            {
+                m_cmdLineArgs.roudiConfig.memoryPrefaultMode = roudi::MemoryPrefaultMode::LOCK;
+            }
+            else
+            {
+                IOX_LOG(Error, "Options for memory-prefault are 'off', 'on' and 'lock'!");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+            break;
+        }
+        case 'j':
+        {
+            auto maybeValue = convert::from_string<uint32_t>(optarg);
+            if (!maybeValue.has_value() || maybeValue.value() == 0U
+                || maybeValue.value() > roudi::MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS)
+            {
+                IOX_LOG(Error,
+                        "The number of memory prefault threads must be in the range of [1, "
+                            << roudi::MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS << "]");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+
+            m_cmdLineArgs.roudiConfig.memoryPrefaultThreadCount = maybeValue.value();
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -22,6 +22,7 @@
 #include "iox/file_reader.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
+#include "iox/path.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/string.hpp"
@@ -36,6 +37,11 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+constexpr const char DEFAULT_HUGE_PAGE_MOUNT_POINT[] = "/dev/hugepages";
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -148,6 +154,17 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.m_fallbackToLargerMemPool = segment->get_as<bool>("fallback-to-larger-mempool").value_or(false);
+        mempoolConfig.m_embedChunkManagement = segment->get_as<bool>("embedded-chunk-management").value_or(false);
+        auto memPoolType = segment->get_as<std::string>("mempool-type").value_or("fixed-size");
+        if (memPoolType == "buddy")
+        {
+            mempoolConfig.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+        }
+        else if (memPoolType != "fixed-size")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_TYPE);
+        }
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -171,12 +188,42 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             {
                 return iox::err(iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT);
             }
-            mempoolConfig.addMemPool({*chunkSize, *chunkCount});
+            auto numaNode = mempool->get_as<uint32_t>("numa-node");
+            auto overflowChunkCount = mempool->get_as<uint32_t>("overflow-count").value_or(0U);
+            mempoolConfig.addMemPool({*chunkSize,
+                                      *chunkCount,
+                                      numaNode ? optional<uint32_t>(*numaNode) : optional<uint32_t>(nullopt),
+                                      overflowChunkCount});
+        }
+
+        iox::mepoo::HugePageConfig hugePageConfig;
+        hugePageConfig.m_pageSize = segment->get_as<uint64_t>("huge-page-size").value_or(0U);
+        if (hugePageConfig.isEnabled())
+        {
+            auto mountPoint =
+                segment->get_as<std::string>("huge-page-mount-point").value_or(DEFAULT_HUGE_PAGE_MOUNT_POINT);
+            auto mountPointString = into<optional<string<platform::IOX_MAX_PATH_LENGTH>>>(mountPoint);
+            if (!mountPointString)
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT_POINT);
+            }
+            auto mountPointPath = Path::create(*mountPointString);
+            if (mountPointPath.has_error())
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT_POINT);
+            }
+            hugePageConfig.m_mountPoint = mountPointPath.value();
         }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
              mempoolConfig});
+        parsedConfig.m_sharedMemorySegments.back().m_hugePageConfig = hugePageConfig;
+        if (auto numaNode = segment->get_as<uint32_t>("numa-node"))
+        {
+            parsedConfig.m_sharedMemorySegments.back().m_numaNode = *numaNode;
+        }
     }
 
     return iox::ok(parsedConfig);
@@ -41,43 +41,76 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    // entry does not exist, reuse a slot which was occupied by a previously removed entry or append a new entry at the
+    // end (the size only grows up to capacity)
+    if (m_numberOfFreeIndices > 0U)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        --m_numberOfFreeIndices;
+        index = m_freeIndices[m_numberOfFreeIndices];
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    addToIndices(index);
+    m_dataChanged = true;
+    return ok();
+}
+
+void ServiceRegistry::addToIndices(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    const auto& service = serviceDescription.getServiceIDString();
+    const auto& instance = serviceDescription.getInstanceIDString();
+    const auto& event = serviceDescription.getEventIDString();
+    const auto serviceHash = idStringHash(service);
+    const auto instanceHash = idStringHash(instance);
+    const auto eventHash = idStringHash(event);
+
+    // the new entry is unique, therefore it does not have the same service description as any other entry
+    m_serviceDescriptionIndex.insert(
+        index, serviceDescriptionHash(serviceHash, instanceHash, eventHash), [](auto) { return false; });
+    m_serviceIndex.insert(index, serviceHash, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getServiceIDString() == service;
+    });
+    m_instanceIndex.insert(index, instanceHash, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getInstanceIDString() == instance;
+    });
+    m_eventIndex.insert(index, eventHash, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getEventIDString() == event;
+    });
+}
+
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    m_serviceDescriptionIndex.remove(index, [&](const uint32_t other) { return other == index; });
+    m_serviceIndex.remove(index, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getServiceIDString()
+               == serviceDescription.getServiceIDString();
+    });
+    m_instanceIndex.remove(index, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getInstanceIDString()
+               == serviceDescription.getInstanceIDString();
+    });
+    m_eventIndex.remove(index, [&](const uint32_t other) {
+        return m_serviceDescriptions[other]->serviceDescription.getEventIDString()
+               == serviceDescription.getEventIDString();
+    });
+
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndices[m_numberOfFreeIndices] = index;
+    ++m_numberOfFreeIndices;
+    m_dataChanged = true;
 }
 
 expected<void, ServiceRegistry::Error>
@@ -103,10 +136,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -123,10 +153,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -137,11 +164,7 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        removeEntry(index);
     }
 }
 
@@ -150,33 +173,85 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (!service && !instance && !event)
     {
-        if (entry)
+        forEach(callable);
+        return;
+    }
+
+    if (service && instance && event)
+    {
+        auto index = findIndex(*service, *instance, *event);
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
-            {
-                callable(*entry);
-            }
+    // only the entries of the shortest chain of the given IDs are visited
+    const Index_t* shortestIndex{nullptr};
+    Index_t::Chain shortestChain;
+    auto selectChain = [&](const Index_t& index,
+                           const optional<capro::IdString_t>& id,
+                           const capro::IdString_t& (capro::ServiceDescription::*getId)() const) {
+        if (!id)
+        {
+            return true;
         }
+        const auto chain = index.find(idStringHash(*id), [&](const uint32_t other) {
+            return (m_serviceDescriptions[other]->serviceDescription.*getId)() == *id;
+        });
+        if (shortestIndex == nullptr || chain.length < shortestChain.length)
+        {
+            shortestIndex = &index;
+            shortestChain = chain;
+        }
+        return chain.head != NO_INDEX;
+    };
+
+    if (!selectChain(m_serviceIndex, service, &capro::ServiceDescription::getServiceIDString)
+        || !selectChain(m_instanceIndex, instance, &capro::ServiceDescription::getInstanceIDString)
+        || !selectChain(m_eventIndex, event, &capro::ServiceDescription::getEventIDString))
+    {
+        return;
     }
-}
 
-uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
-{
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    for (auto index = shortestChain.head; index != NO_INDEX; index = shortestIndex->next(index))
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        auto& entry = m_serviceDescriptions[index];
+        bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+
+        if (match)
         {
-            return i;
+            callable(*entry);
         }
     }
-    return NO_INDEX;
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    return findIndex(serviceDescription.getServiceIDString(),
+                     serviceDescription.getInstanceIDString(),
+                     serviceDescription.getEventIDString());
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::IdString_t& service,
+                                    const capro::IdString_t& instance,
+                                    const capro::IdString_t& event) const noexcept
+{
+    const auto hash = serviceDescriptionHash(idStringHash(service), idStringHash(instance), idStringHash(event));
+    return m_serviceDescriptionIndex
+        .find(hash,
+              [&](const uint32_t other) {
+                  const auto& serviceDescription = m_serviceDescriptions[other]->serviceDescription;
+                  return serviceDescription.getServiceIDString() == service
+                         && serviceDescription.getInstanceIDString() == instance
+                         && serviceDescription.getEventIDString() == event;
+              })
+        .head;
 }
 
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iox/detail/convert.hpp"
+#include "iox/detail/posix_prefault.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/scope_guard.hpp"
@@ -34,7 +35,8 @@ expected<SharedMemoryUser, SharedMemoryUserError>
 SharedMemoryUser::create(const DomainId domainId,
                          const uint64_t segmentId,
                          const uint64_t managementShmSize,
-                         const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+                         const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                         const bool prefaultMemory) noexcept
 {
     ShmVector_t shmSegments;
     ScopeGuard shmCleaner{[] {}, [&shmSegments] { SharedMemoryUser::destroy(shmSegments); }};
@@ -46,7 +48,9 @@ SharedMemoryUser::create(const DomainId domainId,
                                   ResourceType::ICEORYX_DEFINED,
                                   {roudi::SHM_NAME},
                                   managementShmSize,
-                                  AccessMode::ReadWrite);
+                                  AccessMode::ReadWrite,
+                                  nullopt,
+                                  prefaultMemory);
     if (shmOpen.has_error())
     {
         return err(shmOpen.error());
@@ -70,7 +74,9 @@ SharedMemoryUser::create(const DomainId domainId,
                                       ResourceType::USER_DEFINED,
                                       segment.m_sharedMemoryName,
                                       segment.m_size,
-                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly);
+                                      segment.m_isWritable ? AccessMode::ReadWrite : AccessMode::ReadOnly,
+                                      segment.m_hugePageMountPoint,
+                                      prefaultMemory);
         if (shmOpen.has_error())
         {
             return err(shmOpen.error());
@@ -108,13 +114,16 @@ expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector
                                                                        const ResourceType resourceType,
                                                                        const ShmName_t& shmName,
                                                                        const uint64_t shmSize,
-                                                                       const AccessMode accessMode) noexcept
+                                                                       const AccessMode accessMode,
+                                                                       const optional<Path>& mountPoint,
+                                                                       const bool prefaultMemory) noexcept
 {
     auto shmResult = PosixSharedMemoryObjectBuilder()
                          .name(concatenate(iceoryxResourcePrefix(domainId, resourceType), shmName))
                          .memorySizeInBytes(shmSize)
                          .accessMode(accessMode)
                          .openMode(OpenMode::OpenExisting)
+                         .mountPoint(mountPoint)
                          .create();
 
     if (shmResult.has_error())
@@ -131,6 +140,12 @@ expected<void, SharedMemoryUserError> SharedMemoryUser::openShmSegment(ShmVector
         return err(SharedMemoryUserError::RELATIVE_POINTER_MAPPING_ERROR);
     }
 
+    if (prefaultMemory)
+    {
+        // the memory is already in use by other processes, therefore the pages must only be read
+        detail::prefaultMemory(shm.getBaseAddress(), shmSize, AccessMode::ReadOnly);
+    }
+
     IOX_LOG(
         Debug,
         "Application registered " << ((resourceType == ResourceType::ICEORYX_DEFINED) ? "management" : "payload data")
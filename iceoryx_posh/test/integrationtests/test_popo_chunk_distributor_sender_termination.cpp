@@ -0,0 +1,215 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(__linux__)
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/atomic.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/optional.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+using namespace iox::units::duration_literals;
+
+static constexpr uint32_t NUMBER_OF_QUEUES{4U};
+static constexpr uint32_t NUMBER_OF_CHUNKS{64U};
+static constexpr uint64_t CHUNK_SIZE{128U};
+static constexpr uint32_t ITERATIONS{20U};
+static constexpr size_t MEMORY_SIZE{1U << 20U};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = NUMBER_OF_QUEUES;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = NUMBER_OF_CHUNKS / (4U * NUMBER_OF_QUEUES);
+};
+
+using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    ChunkDistributorData<ChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = ChunkDistributor<ChunkDistributorData_t>;
+using ChunkQueuePopper_t = ChunkQueuePopper<ChunkQueueData_t>;
+
+/// @brief everything the publisher process and RouDi share; it is placed in a shared mapping which is inherited by the
+/// forked publisher process
+struct SharedState
+{
+    MemoryManager memoryManager;
+    ChunkDistributorData_t distributorData{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    /// the first half of the queues is used during the stress phase, the second half after the termination
+    iox::optional<ChunkQueueData_t> queues[2U * NUMBER_OF_QUEUES];
+    iox::concurrent::Atomic<uint64_t> numberOfDeliveries{0U};
+    alignas(64) uint8_t memory[MEMORY_SIZE];
+};
+
+class ChunkDistributorSenderTermination_IntegrationTest : public Test
+{
+  public:
+    void SetUp() override
+    {
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void TearDown() override
+    {
+        if (m_publisherPid > 0)
+        {
+            kill(m_publisherPid, SIGKILL);
+            waitpid(m_publisherPid, nullptr, 0);
+        }
+        destroySharedState();
+    }
+
+    void createSharedState()
+    {
+        void* sharedMemory =
+            mmap(nullptr, sizeof(SharedState), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        ASSERT_THAT(sharedMemory, Ne(MAP_FAILED));
+        m_state = new (sharedMemory) SharedState();
+
+        MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        iox::BumpAllocator allocator{m_state->memory, MEMORY_SIZE};
+        m_state->memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+
+        for (auto& queue : m_state->queues)
+        {
+            queue.emplace(QueueFullPolicy::DISCARD_OLDEST_DATA, VariantQueueTypes::SoFi_SingleProducerSingleConsumer);
+        }
+    }
+
+    void destroySharedState()
+    {
+        if (m_state != nullptr)
+        {
+            m_state->~SharedState();
+            munmap(m_state, sizeof(SharedState));
+            m_state = nullptr;
+        }
+    }
+
+    /// @brief publishes until the process is killed
+    [[noreturn]] void publishForever()
+    {
+        ChunkDistributor_t sut{&m_state->distributorData};
+        while (true)
+        {
+            m_state->memoryManager.getChunk(m_chunkSettings).and_then([&](auto& chunk) {
+                sut.deliverToAllStoredQueues(chunk);
+                m_state->numberOfDeliveries.fetch_add(1U, std::memory_order_relaxed);
+            });
+        }
+    }
+
+    SharedState* m_state{nullptr};
+    pid_t m_publisherPid{0};
+    ChunkSettings m_chunkSettings{ChunkSettings::create(CHUNK_SIZE / 2U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                      .expect("Valid 'ChunkSettings'")};
+
+    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{10_s};
+    Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
+};
+
+TEST_F(ChunkDistributorSenderTermination_IntegrationTest, PublisherKilledWhileDeliveringDoesNotBlockQueueModifications)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6fde5dc1-49dd-40b9-b55e-b194a2c71a04");
+
+    for (uint32_t iteration = 0U; iteration < ITERATIONS; ++iteration)
+    {
+        createSharedState();
+        ChunkDistributor_t sut{&m_state->distributorData};
+        for (uint32_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+        {
+            ASSERT_FALSE(sut.tryAddQueue(&m_state->queues[i].value()).has_error());
+        }
+
+        m_publisherPid = fork();
+        ASSERT_THAT(m_publisherPid, Ne(-1));
+        if (m_publisherPid == 0)
+        {
+            publishForever();
+        }
+
+        while (m_state->numberOfDeliveries.load(std::memory_order_relaxed) == 0U)
+        {
+            std::this_thread::yield();
+        }
+
+        // RouDi modifies the queues while the publisher delivers; the number of modifications varies in order to kill
+        // the publisher at different points of the delivery
+        const uint32_t numberOfModifications = 1U + ((iteration * 7U) % 50U);
+        for (uint32_t i = 0U; i < numberOfModifications; ++i)
+        {
+            auto& queue = m_state->queues[i % NUMBER_OF_QUEUES].value();
+            EXPECT_FALSE(sut.tryRemoveQueue(&queue).has_error());
+            EXPECT_FALSE(sut.tryAddQueue(&queue).has_error());
+        }
+
+        kill(m_publisherPid, SIGKILL);
+        int status{0};
+        ASSERT_THAT(waitpid(m_publisherPid, &status, 0), Eq(m_publisherPid));
+        EXPECT_TRUE(WIFSIGNALED(status));
+        m_publisherPid = 0;
+
+        // the queues of the stress phase might be in the middle of a push of the terminated publisher, therefore the
+        // delivery is verified with the second half of the queues
+        const auto startOfModifications = std::chrono::steady_clock::now();
+        sut.cleanup();
+        sut.removeAllQueues();
+        for (uint32_t i = NUMBER_OF_QUEUES; i < 2U * NUMBER_OF_QUEUES; ++i)
+        {
+            ASSERT_FALSE(sut.tryAddQueue(&m_state->queues[i].value()).has_error());
+        }
+        const auto durationOfModifications = std::chrono::steady_clock::now() - startOfModifications;
+        EXPECT_THAT(durationOfModifications, Lt(std::chrono::milliseconds(500)));
+
+        {
+            auto chunk = m_state->memoryManager.getChunk(m_chunkSettings);
+            ASSERT_FALSE(chunk.has_error());
+            EXPECT_THAT(sut.deliverToAllStoredQueues(chunk.value()), Eq(NUMBER_OF_QUEUES));
+            for (uint32_t i = NUMBER_OF_QUEUES; i < 2U * NUMBER_OF_QUEUES; ++i)
+            {
+                EXPECT_TRUE(ChunkQueuePopper_t(&m_state->queues[i].value()).tryPop().has_value());
+            }
+        }
+
+        destroySharedState();
+    }
+}
+} // namespace
+
+#endif
@@ -0,0 +1,225 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/latest_value_publisher.hpp"
+#include "iceoryx_posh/popo/latest_value_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+using namespace iox::testing;
+using namespace iox::units::duration_literals;
+
+struct Pose
+{
+    uint64_t position{0U};
+    uint64_t inversePosition{~0ULL};
+};
+
+Pose makePose(const uint64_t position)
+{
+    return Pose{position, ~position};
+}
+
+class LatestValue_test : public RouDi_GTest
+{
+  public:
+    LatestValue_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().payloadChunkSize(128).create())
+    {
+    }
+
+    void SetUp() override
+    {
+        runtime::PoshRuntime::initRuntime("LatestValue_test");
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    std::unique_ptr<LatestValuePublisher<Pose>> createPublisher()
+    {
+        return std::make_unique<LatestValuePublisher<Pose>>(m_serviceDescription);
+    }
+
+    std::unique_ptr<LatestValueSubscriber<Pose>> createSubscriber()
+    {
+        return std::make_unique<LatestValueSubscriber<Pose>>(m_serviceDescription);
+    }
+
+    Watchdog m_watchdog{units::Duration::fromSeconds(5)};
+    capro::ServiceDescription m_serviceDescription{"LatestValue", "IntegrationTest", "Pose"};
+};
+
+TEST_F(LatestValue_test, SubscriberHasNoValueBeforeFirstUpdate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0677894e-30ef-469f-8c32-5bce47e26515");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    EXPECT_TRUE(publisher->hasSubscribers());
+    EXPECT_FALSE(subscriber->hasData());
+    EXPECT_FALSE(subscriber->take().has_value());
+}
+
+TEST_F(LatestValue_test, SubscriberTakesOnlyTheLatestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9fbc13dc-cc32-4e82-afe8-dfb8cede4276");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    for (uint64_t position = 1U; position <= 3U; ++position)
+    {
+        ASSERT_FALSE(publisher->update(makePose(position)).has_error());
+    }
+
+    EXPECT_TRUE(subscriber->hasData());
+    auto value = subscriber->take();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->position, Eq(3U));
+    EXPECT_FALSE(subscriber->hasData());
+}
+
+TEST_F(LatestValue_test, ValueCanBeTakenMultipleTimes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b265796-a917-4e50-89c1-ade6b5273f0d");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    ASSERT_FALSE(publisher->update(makePose(42U)).has_error());
+
+    ASSERT_TRUE(subscriber->take().has_value());
+    auto value = subscriber->take();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->position, Eq(42U));
+}
+
+TEST_F(LatestValue_test, UpdateAfterTakeIsDetectedAsNewData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "860bc38b-6bea-4000-9e5c-1b074fa1a951");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    ASSERT_FALSE(publisher->update(makePose(1U)).has_error());
+    ASSERT_TRUE(subscriber->take().has_value());
+    ASSERT_FALSE(subscriber->hasData());
+
+    ASSERT_FALSE(publisher->update(makePose(2U)).has_error());
+
+    EXPECT_TRUE(subscriber->hasData());
+    auto value = subscriber->take();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->position, Eq(2U));
+}
+
+TEST_F(LatestValue_test, LateSubscriberTakesTheLatestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b5f4496-9786-4456-9521-20c5acf1846b");
+    auto publisher = createPublisher();
+    ASSERT_FALSE(publisher->update(makePose(1U)).has_error());
+    ASSERT_FALSE(publisher->update(makePose(2U)).has_error());
+
+    auto subscriber = createSubscriber();
+
+    auto value = subscriber->take();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->position, Eq(2U));
+}
+
+TEST_F(LatestValue_test, AllSubscribersTakeTheLatestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "38720049-9e16-4902-8d2e-7eaa506ab3c4");
+    auto publisher = createPublisher();
+    auto subscriber1 = createSubscriber();
+    auto subscriber2 = createSubscriber();
+
+    ASSERT_FALSE(publisher->update(makePose(1U)).has_error());
+    ASSERT_FALSE(publisher->update(makePose(7U)).has_error());
+
+    for (auto* subscriber : {subscriber1.get(), subscriber2.get()})
+    {
+        auto value = subscriber->take();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value->position, Eq(7U));
+    }
+}
+
+TEST_F(LatestValue_test, WaitSetIsNotifiedOnEveryUpdate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "216aa07e-0baf-41e4-bca0-ba9ec5b9cde2");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    WaitSet<1U> waitSet;
+    ASSERT_FALSE(waitSet.attachState(*subscriber, SubscriberState::HAS_DATA).has_error());
+
+    for (uint64_t position = 1U; position <= 3U; ++position)
+    {
+        ASSERT_FALSE(publisher->update(makePose(position)).has_error());
+
+        auto notificationVector = waitSet.timedWait(1_s);
+        ASSERT_THAT(notificationVector.size(), Eq(1U));
+        EXPECT_TRUE(notificationVector[0]->doesOriginateFrom(subscriber.get()));
+
+        auto value = subscriber->take();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value->position, Eq(position));
+
+        EXPECT_TRUE(waitSet.timedWait(1_ms).empty());
+    }
+}
+
+TEST_F(LatestValue_test, ConcurrentUpdatesAreNeverTakenTorn)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2e2b8cd-ce5f-47e3-ad3c-87db61b09a51");
+    auto publisher = createPublisher();
+    auto subscriber = createSubscriber();
+
+    constexpr uint64_t NUMBER_OF_UPDATES{100000U};
+    ASSERT_FALSE(publisher->update(makePose(0U)).has_error());
+
+    std::thread writer([&] {
+        for (uint64_t position = 1U; position <= NUMBER_OF_UPDATES; ++position)
+        {
+            ASSERT_FALSE(publisher->update(makePose(position)).has_error());
+        }
+    });
+
+    uint64_t lastPosition{0U};
+    while (lastPosition < NUMBER_OF_UPDATES)
+    {
+        auto value = subscriber->take();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value->inversePosition, Eq(~value->position));
+        EXPECT_THAT(value->position, Ge(lastPosition));
+        lastPosition = value->position;
+    }
+
+    writer.join();
+}
+
+} // namespace
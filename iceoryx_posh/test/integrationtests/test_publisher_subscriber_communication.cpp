@@ -754,6 +754,46 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, PublisherWithBroadcastRingDeliversToAllSubscribersAndDetectsSlowOnes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26331aa8-796b-4e35-8cac-f130a0ae335a");
+    constexpr uint64_t BROADCAST_RING_CAPACITY{4U};
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    options.broadcastRingCapacity = BROADCAST_RING_CAPACITY;
+    iox::popo::Publisher<uint64_t> publisher{capro::ServiceDescription{m_serviceDescription.getServiceIDString(),
+                                                                       m_serviceDescription.getInstanceIDString(),
+                                                                       m_serviceDescription.getEventIDString(),
+                                                                       {0U, 0U, 0U, 0U},
+                                                                       capro::Interfaces::INTERNAL},
+                                             options};
+    EXPECT_FALSE(publisher.publishCopyOf(0U).has_error());
+
+    auto fastSubscriber = createSubscriber<uint64_t>();
+    auto slowSubscriber = createSubscriber<uint64_t>(1U);
+
+    // the slow subscriber starts with the history and is overtaken by the publisher
+    for (uint64_t i = 1U; i <= BROADCAST_RING_CAPACITY; ++i)
+    {
+        EXPECT_FALSE(publisher.publishCopyOf(i).has_error());
+
+        auto sample = fastSubscriber->take();
+        ASSERT_FALSE(sample.has_error());
+        EXPECT_THAT(**sample, Eq(i));
+    }
+    EXPECT_FALSE(fastSubscriber->hasData());
+    EXPECT_FALSE(fastSubscriber->hasMissedData());
+
+    for (uint64_t i = 1U; i <= BROADCAST_RING_CAPACITY; ++i)
+    {
+        auto sample = slowSubscriber->take();
+        ASSERT_FALSE(sample.has_error());
+        EXPECT_THAT(**sample, Eq(i));
+    }
+    EXPECT_FALSE(slowSubscriber->hasData());
+    EXPECT_TRUE(slowSubscriber->hasMissedData());
+}
+
 #ifdef TEST_WITH_HUGE_PAYLOAD
 
 TEST_F(PublisherSubscriberCommunicationWithBigPayload_test, SendingComplexDataType_BigPayloadStruct)
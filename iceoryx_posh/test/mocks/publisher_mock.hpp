@@ -56,8 +56,16 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint64_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD6(tryAllocateChunks,
+                 iox::expected<void, iox::popo::AllocationError>(iox::mepoo::ChunkHeader** const,
+                                                                 const uint32_t,
+                                                                 const uint64_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD2(sendChunks, void(iox::mepoo::ChunkHeader* const* const, const uint32_t));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
@@ -20,6 +20,7 @@
 #include "test.hpp"
 
 #include "iceoryx_posh/roudi/memory/memory_block.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 class MemoryBlockMock final : public iox::roudi::MemoryBlock
@@ -29,6 +30,10 @@ class MemoryBlockMock final : public iox::roudi::MemoryBlock
     MOCK_METHOD(uint64_t, alignment, (), (const, noexcept, override));
     MOCK_METHOD(void, onMemoryAvailable, (iox::not_null<void*>), (noexcept, override));
     MOCK_METHOD(void, destroy, (), (noexcept, override));
+    MOCK_METHOD(void,
+                forEachAdditionalMemory,
+                (const iox::function_ref<void(void*, uint64_t)>),
+                (const, noexcept, override));
 };
 
 #endif // IOX_POSH_MOCKS_ROUDI_MEMORY_BLOCK_MOCK_HPP
@@ -0,0 +1,158 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+
+class BuddyAllocator_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_UNITS{32U};
+    static constexpr uint32_t MAX_ORDER{3U};
+
+    BuddyAllocator_test()
+        : managementMemory(BuddyAllocator::requiredManagementMemorySize(NUMBER_OF_UNITS))
+        , allocator(managementMemory.data(), managementMemory.size() * sizeof(uint64_t))
+        , sut(NUMBER_OF_UNITS, MAX_ORDER, allocator)
+    {
+    }
+
+    std::vector<uint64_t> managementMemory;
+    iox::BumpAllocator allocator;
+    BuddyAllocator sut;
+};
+
+TEST_F(BuddyAllocator_test, OrderForNumberOfUnitsIsTheCeilingOfTheBinaryLogarithm)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c0f7e3a-9d2b-4b8e-a1f4-5e7d3c2b9a06");
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(0U), Eq(0U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(1U), Eq(0U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(2U), Eq(1U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(3U), Eq(2U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(8U), Eq(3U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(9U), Eq(4U));
+    EXPECT_THAT(BuddyAllocator::orderForNumberOfUnits(std::numeric_limits<uint64_t>::max()),
+                Eq(BuddyAllocator::MAX_NUMBER_OF_ORDERS));
+}
+
+TEST_F(BuddyAllocator_test, AllocatingAllUnitsWithTheSmallestOrderSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a8e5d1c-4f7b-4c3a-9e06-b1d8f2a7c453");
+    std::vector<bool> isUnitAllocated(NUMBER_OF_UNITS, false);
+    for (uint32_t i = 0U; i < NUMBER_OF_UNITS; ++i)
+    {
+        auto index = sut.allocate(0U);
+        ASSERT_TRUE(index.has_value());
+        ASSERT_THAT(index.value(), Lt(NUMBER_OF_UNITS));
+        EXPECT_FALSE(isUnitAllocated[index.value()]);
+        isUnitAllocated[index.value()] = true;
+    }
+
+    EXPECT_FALSE(sut.allocate(0U).has_value());
+}
+
+TEST_F(BuddyAllocator_test, AllocatedBlocksAreAlignedToTheirSizeAndDoNotOverlap)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3b7a9c2-1e6d-4a58-8c0b-7d4e2f9a1b36");
+    std::vector<bool> isUnitAllocated(NUMBER_OF_UNITS, false);
+    for (const uint32_t order : {0U, 3U, 1U, 2U, 0U, 3U, 1U})
+    {
+        auto index = sut.allocate(order);
+        ASSERT_TRUE(index.has_value());
+        const auto blockSize = 1U << order;
+        EXPECT_THAT(index.value() % blockSize, Eq(0U));
+        for (uint32_t unit = index.value(); unit < index.value() + blockSize; ++unit)
+        {
+            ASSERT_THAT(unit, Lt(NUMBER_OF_UNITS));
+            EXPECT_FALSE(isUnitAllocated[unit]);
+            isUnitAllocated[unit] = true;
+        }
+    }
+}
+
+TEST_F(BuddyAllocator_test, AllocatingBlockWithTooLargeOrderFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d1c4e7f-2b9a-4f03-a6e5-3c7b0d9f2e18");
+    EXPECT_FALSE(sut.allocate(MAX_ORDER + 1U).has_value());
+    EXPECT_FALSE(sut.allocate(BuddyAllocator::MAX_NUMBER_OF_ORDERS).has_value());
+}
+
+TEST_F(BuddyAllocator_test, DeallocateReturnsTheOrderOfTheBlock)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e9a2f6b-7c1d-4d85-b3a0-e6f1c8d2a794");
+    auto index = sut.allocate(2U);
+    ASSERT_TRUE(index.has_value());
+
+    auto order = sut.deallocate(index.value());
+
+    ASSERT_TRUE(order.has_value());
+    EXPECT_THAT(order.value(), Eq(2U));
+}
+
+TEST_F(BuddyAllocator_test, DeallocatingBlocksCoalescesThemToTheLargestOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7c3e0d9-5b2f-4e16-9d48-1f6b3a8c0e25");
+    std::vector<BuddyAllocator::Index_t> indices;
+    for (uint32_t i = 0U; i < NUMBER_OF_UNITS; ++i)
+    {
+        auto index = sut.allocate(0U);
+        ASSERT_TRUE(index.has_value());
+        indices.push_back(index.value());
+    }
+    EXPECT_FALSE(sut.allocate(MAX_ORDER).has_value());
+
+    for (const auto index : indices)
+    {
+        ASSERT_TRUE(sut.deallocate(index).has_value());
+    }
+
+    for (uint32_t i = 0U; i < NUMBER_OF_UNITS >> MAX_ORDER; ++i)
+    {
+        EXPECT_TRUE(sut.allocate(MAX_ORDER).has_value());
+    }
+    EXPECT_FALSE(sut.allocate(0U).has_value());
+}
+
+TEST_F(BuddyAllocator_test, DeallocatingBlockTwiceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5f8b2e1-0a7d-4c39-8e64-9b2d7f1a3c50");
+    auto index = sut.allocate(1U);
+    ASSERT_TRUE(index.has_value());
+
+    EXPECT_TRUE(sut.deallocate(index.value()).has_value());
+    EXPECT_FALSE(sut.deallocate(index.value()).has_value());
+}
+
+TEST_F(BuddyAllocator_test, DeallocatingIndexWhichIsNotTheStartOfAnAllocatedBlockFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b6d9f4a-3e8c-4a27-b0f5-d2c7e9a1b863");
+    auto index = sut.allocate(2U);
+    ASSERT_TRUE(index.has_value());
+
+    EXPECT_FALSE(sut.deallocate(index.value() + 1U).has_value());
+    EXPECT_FALSE(sut.deallocate(NUMBER_OF_UNITS).has_value());
+}
+
+} // namespace
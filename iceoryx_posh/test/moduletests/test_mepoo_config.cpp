@@ -118,6 +118,28 @@ TEST_F(MePooConfig_Test, OptimizeMethodCombinesTwoMempoolWithSameSizeAndDoublesT
     EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT * 2U));
 }
 
+TEST_F(MePooConfig_Test, OptimizeMethodKeepsMempoolsWithSameSizeOnDifferentNumaNodesApartOrderedByNumaNode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b7e3d9a-5c2f-4a86-b0e4-9d6c8f1a2e35");
+    MePooConfig sut;
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint64_t SIZE{100U};
+    sut.addMemPool({SIZE, CHUNK_COUNT, 1U});
+    sut.addMemPool({SIZE, CHUNK_COUNT, 0U});
+    sut.addMemPool({SIZE, CHUNK_COUNT});
+    sut.addMemPool({SIZE, CHUNK_COUNT, 1U});
+
+    sut.optimize();
+
+    ASSERT_THAT(sut.m_mempoolConfig.size(), Eq(3U));
+    EXPECT_FALSE(sut.m_mempoolConfig[0].m_numaNode.has_value());
+    EXPECT_THAT(sut.m_mempoolConfig[0].m_chunkCount, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_numaNode, Eq(iox::optional<uint32_t>(0U)));
+    EXPECT_THAT(sut.m_mempoolConfig[1].m_chunkCount, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut.m_mempoolConfig[2].m_numaNode, Eq(iox::optional<uint32_t>(1U)));
+    EXPECT_THAT(sut.m_mempoolConfig[2].m_chunkCount, Eq(CHUNK_COUNT * 2U));
+}
+
 TEST_F(MePooConfig_Test, OptimizeMethodRemovesTheMempoolWithSizeZeroInTheMemPoolConfigContainer)
 {
     ::testing::Test::RecordProperty("TEST_ID", "56209c3e-8b69-45cd-8ea5-ef347152ff7c");
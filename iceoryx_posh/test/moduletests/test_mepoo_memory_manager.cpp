@@ -21,11 +21,14 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/hoofs_error_reporting.hpp"
+#include "iox/detail/posix_numa.hpp"
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 using namespace ::testing;
@@ -443,6 +446,520 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     IOX_EXPECT_FATAL_FAILURE([&] { sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, iox::er::FATAL);
 }
 
+TEST_F(MemoryManager_test, GetChunkWithMagazineCachesChunksWhichAreReturnedByDrain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2632a6b-af7f-4c01-89f9-14764822e20b");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkMagazine chunkMagazine;
+    {
+        auto chunk = sut->getChunk(chunkSettings_128, chunkMagazine);
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_TRUE(chunk.value());
+        EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, iox::mepoo::MemPoolMagazine::CAPACITY);
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, iox::mepoo::MemPoolMagazine::CAPACITY - 1U);
+
+    chunkMagazine.drain();
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, GetChunkWithMagazineCanAcquireAllChunksOfTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3b8a3d2-3494-441a-ade3-8729a4872a12");
+    constexpr uint32_t CHUNK_COUNT{20U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkMagazine chunkMagazine;
+    ChunkStore chunkStore;
+    for (uint32_t i = 0; i < CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettings_128, chunkMagazine)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_128, chunkMagazine)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, GetChunksObtainsAllRequestedChunksAtOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15a87038-3adc-42ea-9fe9-ecc0e64ea7f0");
+    constexpr uint32_t CHUNK_COUNT{iox::mepoo::MemPoolMagazine::CAPACITY + 3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk chunks[CHUNK_COUNT];
+    ASSERT_FALSE(sut->getChunks(chunkSettings_128, &chunks[0], CHUNK_COUNT).has_error());
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+    for (auto& chunk : chunks)
+    {
+        ASSERT_TRUE(chunk);
+        EXPECT_EQ(chunk.getChunkHeader()->userPayloadSize(), chunkSettings_128.userPayloadSize());
+    }
+}
+
+TEST_F(MemoryManager_test, GetChunksObtainsNoChunkWhenNotAllRequestedChunksAreAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e0f4b57-1c2a-4f0d-9a67-5d5b7f3c2a18");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk chunks[CHUNK_COUNT + 1U];
+    auto result = sut->getChunks(chunkSettings_128, &chunks[0], CHUNK_COUNT + 1U);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS);
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+    for (auto& chunk : chunks)
+    {
+        EXPECT_FALSE(chunk);
+    }
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, ChunksCachedInMagazineAreNotAvailableForOtherUsersUntilDrained)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "21dd30f4-d360-4182-91c1-ab9703640028");
+    constexpr uint32_t CHUNK_COUNT{iox::mepoo::MemPoolMagazine::CAPACITY + 1U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkMagazine chunkMagazine;
+    auto chunkFromMagazine = sut->getChunk(chunkSettings_128, chunkMagazine);
+    ASSERT_FALSE(chunkFromMagazine.has_error());
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT - iox::mepoo::MemPoolMagazine::CAPACITY, chunkSettings_128);
+
+    EXPECT_TRUE(sut->getChunk(chunkSettings_128).has_error());
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+
+    chunkMagazine.drain();
+
+    EXPECT_FALSE(sut->getChunk(chunkSettings_128).has_error());
+}
+
+TEST_F(MemoryManager_test, ChunksObtainedFromDifferentMempoolsWithMagazineDoNotExhaustTheChunkManagementPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed40edf7-58f2-4598-ae56-a8ecd4cbc421");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkMagazine chunkMagazine;
+    auto chunk32 = sut->getChunk(chunkSettings_32, chunkMagazine);
+    ASSERT_FALSE(chunk32.has_error());
+    auto chunk64 = sut->getChunk(chunkSettings_64, chunkMagazine);
+    ASSERT_FALSE(chunk64.has_error());
+
+    // the chunks which are still available in the mempools must all get a ChunkManagement
+    auto chunkStore32 = getChunksFromSut(CHUNK_COUNT - 1U, chunkSettings_32);
+    chunkMagazine.drain();
+    auto chunkStore64 = getChunksFromSut(CHUNK_COUNT - 1U, chunkSettings_64);
+
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, CHUNK_COUNT);
+}
+
+TEST_F(MemoryManager_test, GetChunkSelectsTheBestFittingMemPoolForMemPoolsWithinTheSameSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f3f29c5-6a0e-4a8f-9d0b-5b1b2b9e7c61");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    const std::vector<uint64_t> CHUNK_PAYLOAD_SIZES{32U, 40U, 48U, 96U, 200U, 1000U, 1024U};
+    for (const auto size : CHUNK_PAYLOAD_SIZES)
+    {
+        mempoolconf.addMemPool({size, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_PAYLOAD_SIZES.size(); ++i)
+    {
+        const uint64_t smallestFittingPayloadSize = (i == 0U) ? 1U : CHUNK_PAYLOAD_SIZES[i - 1U] + 1U;
+        for (const auto payloadSize : {smallestFittingPayloadSize, CHUNK_PAYLOAD_SIZES[i]})
+        {
+            auto chunkSettings = iox::mepoo::ChunkSettings::create(static_cast<uint32_t>(payloadSize),
+                                                                   iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                     .value();
+            sut->getChunk(chunkSettings)
+                .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+                .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+        }
+    }
+
+    for (uint32_t i = 0U; i < CHUNK_PAYLOAD_SIZES.size(); ++i)
+    {
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(2U));
+    }
+}
+
+TEST_F(MemoryManager_test, GetChunkWithFallbackObtainsChunkFromNextLargerMemPoolWhenBestFitIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3c4e0f2-0a77-4fd5-8f0c-4a1f8d6f2b90");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.m_fallbackToLargerMemPool = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStoreFallback = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    for (const auto& chunk : chunkStoreFallback)
+    {
+        EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_32));
+    }
+}
+
+TEST_F(MemoryManager_test, GetChunkWithFallbackFailsWhenAllLargerMemPoolsAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d2b1e4a-3c3f-4b8e-a0b5-17e5c2f9d8a4");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.m_fallbackToLargerMemPool = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_64);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesOverflowChunksBeforeFallbackToLargerMemPoolWithTheRequiredMemorySize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "917e9bfc-354d-4d50-be29-6caa6f7e4c41");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{5U};
+    mempoolconf.m_fallbackToLargerMemPool = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, iox::nullopt, OVERFLOW_CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+
+    const auto requiredMemorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolconf);
+    auto* memory = malloc(requiredMemorySize);
+    iox::BumpAllocator exactAllocator(memory, requiredMemorySize);
+    sut->configureMemoryManager(mempoolconf, exactAllocator, exactAllocator);
+
+    // chunks are freed when they go out of scope
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT + OVERFLOW_CHUNK_COUNT, chunkSettings_32);
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedOverflowChunks, Eq(OVERFLOW_CHUNK_COUNT));
+        EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+
+        auto chunkStoreFallback = getChunksFromSut(1U, chunkSettings_32);
+        EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedOverflowChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(0U));
+
+    delete sut;
+    sut = nullptr;
+    free(memory);
+}
+
+TEST_F(MemoryManager_test, GetChunkFailsWhenRegularAndOverflowChunksAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b516c092-4116-4233-9c3e-a69f908a6ef8");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t OVERFLOW_CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, iox::nullopt, OVERFLOW_CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + OVERFLOW_CHUNK_COUNT, chunkSettings_32);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, AddingMempoolsWithSameChunkSizeWithoutDifferentNumaNodesReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a4c1f7e-2d6b-4e93-b5a0-3c9e7d1f6b28");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U});
+
+    IOX_EXPECT_FATAL_FAILURE([&] { sut->configureMemoryManager(mempoolconf, *allocator, *allocator); },
+                             iox::PoshError::MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
+}
+
+TEST_F(MemoryManager_test, GetChunkPrefersTheMemPoolOnTheNumaNodeOfTheCallingThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6b2d8f4-7a1c-4f35-9e0b-5d3a9c7e1f42");
+    const auto numaNode = iox::detail::numaNodeOfCurrentThread();
+    if (!numaNode.has_value())
+    {
+        GTEST_SKIP() << "NUMA is not supported on this platform";
+    }
+
+    // the NUMA local mempool is deliberately the second one with the same chunk size
+    constexpr uint32_t CHUNK_COUNT{10U};
+    const uint32_t remoteNumaNode = (numaNode.value() == 0U) ? 1U : 0U;
+    const uint32_t firstNumaNode = std::min(numaNode.value(), remoteNumaNode);
+    const uint32_t secondNumaNode = std::max(numaNode.value(), remoteNumaNode);
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, firstNumaNode});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, secondNumaNode});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+
+    const uint32_t localMemPoolIndex = (firstNumaNode == numaNode.value()) ? 0U : 1U;
+    EXPECT_THAT(sut->getMemPoolInfo(localMemPoolIndex).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U - localMemPoolIndex).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(localMemPoolIndex).m_numaNode, Eq(numaNode));
+}
+
+TEST_F(MemoryManager_test, GetChunkUsesMemPoolsOnOtherNumaNodesWhenTheNumaLocalMemPoolIsExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d9f5b1e-8c4a-4726-a1f3-6e0b2d8c5a97");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 0U});
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT, 1U});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0U));
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, GetChunkFromBuddyMemPoolHasSmallestSufficientPowerOfTwoOfTheSmallestChunkSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2a7d4c9-8f1b-4b63-a05e-6c9d3f2b7e81");
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    ASSERT_THAT(sut->getNumberOfMemPools(), Eq(1U));
+    const auto minChunkSize = sut->getMemPoolInfo(0).m_chunkSize;
+    EXPECT_THAT(minChunkSize, Eq(chunkSettings_32.requiredChunkSize()));
+
+    for (const auto& chunkSettings : {chunkSettings_32, chunkSettings_64, chunkSettings_128, chunkSettings_256})
+    {
+        auto chunk = sut->getChunk(chunkSettings);
+        ASSERT_FALSE(chunk.has_error());
+        const auto chunkSize = chunk.value().getChunkHeader()->chunkSize();
+        const auto numberOfMinChunks = chunkSize / minChunkSize;
+        EXPECT_THAT(chunkSize % minChunkSize, Eq(0U));
+        EXPECT_THAT(numberOfMinChunks & (numberOfMinChunks - 1U), Eq(0U));
+        EXPECT_THAT(chunkSize, Ge(chunkSettings.requiredChunkSize()));
+        EXPECT_THAT(chunkSize / 2U, Lt(chunkSettings.requiredChunkSize()));
+    }
+}
+
+TEST_F(MemoryManager_test, BuddyMemPoolProvidesTheConfiguredChunksAtTheSameTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b3f0e9d-2c6a-4d18-9e57-a4b1c8f3d062");
+    constexpr uint32_t CHUNK_COUNT_32{10U};
+    constexpr uint32_t CHUNK_COUNT_256{3U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT_32});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT_256});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore32 = getChunksFromSut(CHUNK_COUNT_32, chunkSettings_32);
+    auto chunkStore256 = getChunksFromSut(CHUNK_COUNT_256, chunkSettings_256);
+
+    EXPECT_THAT(chunkStore32.size(), Eq(CHUNK_COUNT_32));
+    EXPECT_THAT(chunkStore256.size(), Eq(CHUNK_COUNT_256));
+}
+
+TEST_F(MemoryManager_test, BuddyMemPoolUsesTheMemoryOfReleasedLargeChunksForSmallChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9e6b1a4-0f3c-4e72-8b95-2c7a4d0f1e38");
+    constexpr uint32_t CHUNK_COUNT_32{2U};
+    constexpr uint32_t CHUNK_COUNT_256{2U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT_32});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT_256});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    const auto memPoolInfo = sut->getMemPoolInfo(0);
+    const auto numberOfSmallChunks = memPoolInfo.m_numChunks;
+    {
+        auto chunkStore256 = getChunksFromSut(CHUNK_COUNT_256, chunkSettings_256);
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Ge(CHUNK_COUNT_256 * 2U));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    auto chunkStore32 = getChunksFromSut(numberOfSmallChunks, chunkSettings_32);
+    EXPECT_THAT(chunkStore32.size(), Eq(numberOfSmallChunks));
+    EXPECT_THAT(numberOfSmallChunks, Gt(CHUNK_COUNT_32 + CHUNK_COUNT_256));
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+}
+
+TEST_F(MemoryManager_test, GetChunkFromBuddyMemPoolWithTooLargeChunkFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f8a1c6e-9d2b-4a05-b7e4-0c5f9a2d6b17");
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE};
+    sut->getChunk(chunkSettings_256)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+}
+
+TEST_F(MemoryManager_test, RequiredMemorySizeOfBuddyMemPoolMatchesTheConfiguredMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c2e9b7d-4a1f-4e68-a3d0-8f6b1e4c9a72");
+    constexpr uint32_t CHUNK_COUNT{7U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+
+    const auto requiredMemorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolconf);
+    auto* memory = malloc(requiredMemorySize);
+    iox::BumpAllocator exactAllocator(memory, requiredMemorySize);
+    sut->configureMemoryManager(mempoolconf, exactAllocator, exactAllocator);
+
+    const auto memPoolInfo = sut->getMemPoolInfo(0);
+    EXPECT_THAT(memPoolInfo.m_numChunks * memPoolInfo.m_chunkSize,
+                Eq(iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf)));
+
+    delete sut;
+    sut = nullptr;
+    free(memory);
+}
+
+TEST_F(MemoryManager_test, EmbeddedChunkManagementProvidesAllChunksWithTheRequiredMemorySize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f3cfb34-1381-439b-af40-8a30df6ce7cd");
+    constexpr uint32_t CHUNK_COUNT{20U};
+    mempoolconf.m_embedChunkManagement = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+
+    const auto requiredMemorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolconf);
+    auto* memory = malloc(requiredMemorySize);
+    iox::BumpAllocator exactAllocator(memory, requiredMemorySize);
+    sut->configureMemoryManager(mempoolconf, exactAllocator, exactAllocator);
+
+    // chunks are freed when they go out of scope
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT / 2U, chunkSettings_128);
+        iox::mepoo::SharedChunk chunks[CHUNK_COUNT / 2U];
+        EXPECT_FALSE(sut->getChunks(chunkSettings_128, &chunks[0], CHUNK_COUNT / 2U).has_error());
+        EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, CHUNK_COUNT);
+
+        EXPECT_TRUE(sut->getChunk(chunkSettings_128).has_error());
+        IOX_TESTING_EXPECT_ERROR(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+    }
+
+    EXPECT_EQ(sut->getMemPoolInfo(1U).m_usedChunks, 0U);
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+        EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, CHUNK_COUNT);
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+
+    delete sut;
+    sut = nullptr;
+    free(memory);
+}
+
+TEST_F(MemoryManager_test, EmbeddedChunkManagementIsPlacedAtTheStartOfTheChunkInFrontOfTheChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3cf1df-dec6-4c75-820f-88469ff12fc4");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.m_embedChunkManagement = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChunk(chunkSettings_128);
+    ASSERT_FALSE(chunk.has_error());
+    auto* chunkHeader = chunk->getChunkHeader();
+    auto* chunkManagement = chunk->release();
+    ASSERT_THAT(chunkManagement, Ne(nullptr));
+
+    EXPECT_TRUE(chunkManagement->isEmbeddedInChunk());
+    const auto reservedSize = iox::align(static_cast<uint64_t>(sizeof(iox::mepoo::ChunkManagement)),
+                                         iox::mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT);
+    EXPECT_THAT(reinterpret_cast<uint64_t>(chunkHeader) - reinterpret_cast<uint64_t>(chunkManagement),
+                Eq(reservedSize));
+    EXPECT_THAT(chunkHeader->chunkSize(), Eq(sut->getMemPoolInfo(0U).m_chunkSize - reservedSize));
+    EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(chunkSettings_128.userPayloadSize()));
+
+    // the chunk is released together with its embedded ChunkManagement
+    {
+        iox::mepoo::SharedChunk releasedChunk(chunkManagement);
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+}
+
+TEST_F(MemoryManager_test, BuddyMemPoolWithEmbeddedChunkManagementReleasesTheWholeChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b434239-d0f2-4564-bea6-484eee3aec6d");
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.m_memPoolType = iox::mepoo::MemPoolType::BUDDY;
+    mempoolconf.m_embedChunkManagement = true;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_256);
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Gt(CHUNK_COUNT));
+    }
+    EXPECT_EQ(sut->getMemPoolInfo(0U).m_usedChunks, 0U);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_256);
+    EXPECT_FALSE(sut->getChunk(chunkSettings_32).has_error());
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
@@ -21,10 +21,14 @@
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/hoofs_error_reporting.hpp"
 #include "iox/detail/system_configuration.hpp"
+#include "iox/memory.hpp"
 
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -300,6 +304,166 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunksAcquiresTheRequestedNumberOfChunksAndUpdatesTheStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "773b7abe-a068-4053-987f-f70676f19114");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    std::vector<uint32_t> indices(NUMBER_OF_REQUESTED_CHUNKS, 0U);
+
+    EXPECT_THAT(sut.getChunks(indices.data(), NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+
+    std::vector<uint8_t*> chunks;
+    for (const auto index : indices)
+    {
+        chunks.push_back(static_cast<uint8_t*>(sut.chunkFromIndex(index)));
+    }
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::adjacent_find(chunks.begin(), chunks.end()), Eq(chunks.end()));
+}
+
+TEST_F(MemPool_test, GetChunksIsLimitedByTheNumberOfFreeChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "899073f5-dd7d-4780-9d1b-0c5f6a5b53b6");
+    std::vector<uint32_t> indices(NUMBER_OF_CHUNKS + 1U, 0U);
+
+    EXPECT_THAT(sut.getChunks(indices.data(), NUMBER_OF_CHUNKS + 1U), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunks(indices.data(), 1U), Eq(0U));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, FreeChunksReturnsAllChunksToTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02821fb3-2bba-4f0d-9cc6-6ea5d7f5c1f1");
+    std::vector<uint32_t> indices(NUMBER_OF_CHUNKS, 0U);
+    ASSERT_THAT(sut.getChunks(indices.data(), NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.freeChunks(indices.data(), NUMBER_OF_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+}
+
+TEST_F(MemPool_test, FreeChunksWhenSameChunksAreTriedToFreeTwiceReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b05b0374-221b-47e3-a5bd-bd86cba07158");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{3U};
+    std::vector<uint32_t> indices(NUMBER_OF_REQUESTED_CHUNKS, 0U);
+    ASSERT_THAT(sut.getChunks(indices.data(), NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    sut.freeChunks(indices.data(), NUMBER_OF_REQUESTED_CHUNKS);
+
+    IOX_EXPECT_FATAL_FAILURE([&] { sut.freeChunks(indices.data(), NUMBER_OF_REQUESTED_CHUNKS); },
+                             iox::PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+}
+
+TEST_F(MemPool_test, ChunkFromIndexWithInvalidIndexIsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7414d074-05f5-4c7f-82f9-cf0bec94b4c5");
+
+    IOX_EXPECT_FATAL_FAILURE([&] { sut.chunkFromIndex(NUMBER_OF_CHUNKS); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(MemPool_test, GetOverflowChunkProvidesAdditionalChunksWhenRegularChunksAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "610d5ee0-c211-417d-afa9-c537d1ee6022");
+    constexpr uint32_t NUMBER_OF_REGULAR_CHUNKS{2U};
+    constexpr uint32_t NUMBER_OF_OVERFLOW_CHUNKS{3U};
+    MemPool sutWithOverflow(
+        CHUNK_SIZE, NUMBER_OF_REGULAR_CHUNKS, allocator, allocator, iox::nullopt, NUMBER_OF_OVERFLOW_CHUNKS);
+
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_REGULAR_CHUNKS; ++i)
+    {
+        chunks.push_back(sutWithOverflow.getChunk());
+    }
+    EXPECT_THAT(sutWithOverflow.getChunk(), Eq(nullptr));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_OVERFLOW_CHUNKS; ++i)
+    {
+        chunks.push_back(sutWithOverflow.getOverflowChunk());
+        ASSERT_THAT(chunks.back(), Ne(nullptr));
+    }
+    EXPECT_THAT(sutWithOverflow.getOverflowChunk(), Eq(nullptr));
+
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::unique(chunks.begin(), chunks.end()), Eq(chunks.end()));
+    EXPECT_THAT(sutWithOverflow.getUsedChunks(), Eq(NUMBER_OF_REGULAR_CHUNKS));
+    EXPECT_THAT(sutWithOverflow.getUsedOverflowChunks(), Eq(NUMBER_OF_OVERFLOW_CHUNKS));
+    EXPECT_THAT(sutWithOverflow.getInfo().m_numOverflowChunks, Eq(NUMBER_OF_OVERFLOW_CHUNKS));
+    EXPECT_THAT(sutWithOverflow.getInfo().m_usedOverflowChunks, Eq(NUMBER_OF_OVERFLOW_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunkReturnsOverflowChunkToTheOverflowChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf846abe-719a-4aa8-a33f-13253927bcef");
+    constexpr uint32_t NUMBER_OF_OVERFLOW_CHUNKS{1U};
+    MemPool sutWithOverflow(CHUNK_SIZE, 1U, allocator, allocator, iox::nullopt, NUMBER_OF_OVERFLOW_CHUNKS);
+
+    auto* regularChunk = sutWithOverflow.getChunk();
+    auto* overflowChunk = sutWithOverflow.getOverflowChunk();
+    ASSERT_THAT(overflowChunk, Ne(nullptr));
+
+    sutWithOverflow.freeChunk(overflowChunk);
+
+    EXPECT_THAT(sutWithOverflow.getUsedOverflowChunks(), Eq(0U));
+    EXPECT_THAT(sutWithOverflow.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(sutWithOverflow.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sutWithOverflow.getOverflowChunk(), Eq(overflowChunk));
+    sutWithOverflow.freeChunk(regularChunk);
+    EXPECT_THAT(sutWithOverflow.getUsedChunks(), Eq(0U));
+}
+
+TEST_F(MemPool_test, ReleaseIdleOverflowMemoryDoesNotReleaseUsedOrRecentlyUsedOverflowChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aae6e24a-5ae6-47c6-a4fb-2cf6967f5d0a");
+    MemPool sutWithOverflow(CHUNK_SIZE, 1U, allocator, allocator, iox::nullopt, 1U);
+
+    auto* overflowChunk = sutWithOverflow.getOverflowChunk();
+    ASSERT_THAT(overflowChunk, Ne(nullptr));
+    EXPECT_FALSE(sutWithOverflow.releaseIdleOverflowMemory());
+    EXPECT_FALSE(sutWithOverflow.releaseIdleOverflowMemory());
+
+    sutWithOverflow.freeChunk(overflowChunk);
+    sutWithOverflow.releaseIdleOverflowMemory();
+
+    // the overflow chunks are available again once the release is finished
+    EXPECT_THAT(sutWithOverflow.getOverflowChunk(), Eq(overflowChunk));
+}
+
+TEST_F(MemPool_test, ReleaseIdleOverflowMemoryReleasesThePagesOfIdleOverflowChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a7937d55-0067-4138-9d63-86116e2e792f");
+#if !defined(__linux__)
+    GTEST_SKIP() << "Releasing memory is only supported on Linux";
+#endif
+    const auto pageSize = iox::detail::pageSize();
+    constexpr uint32_t NUMBER_OF_OVERFLOW_CHUNKS{2U};
+    std::vector<uint8_t> memory((2U + NUMBER_OF_OVERFLOW_CHUNKS) * pageSize + 10000U);
+    iox::BumpAllocator pageAlignedAllocator(
+        reinterpret_cast<void*>(iox::align(reinterpret_cast<uint64_t>(memory.data()), pageSize)),
+        (1U + NUMBER_OF_OVERFLOW_CHUNKS) * pageSize + 10000U);
+    MemPool sutWithOverflow(
+        pageSize, 1U, pageAlignedAllocator, pageAlignedAllocator, iox::nullopt, NUMBER_OF_OVERFLOW_CHUNKS);
+
+    auto* overflowChunk = static_cast<uint8_t*>(sutWithOverflow.getOverflowChunk());
+    ASSERT_THAT(overflowChunk, Ne(nullptr));
+    std::fill(overflowChunk, overflowChunk + pageSize, static_cast<uint8_t>(0xAFU));
+    sutWithOverflow.freeChunk(overflowChunk);
+
+    // the first call only notices that an overflow chunk was obtained since the last call
+    EXPECT_FALSE(sutWithOverflow.releaseIdleOverflowMemory());
+    EXPECT_TRUE(sutWithOverflow.releaseIdleOverflowMemory());
+    EXPECT_FALSE(sutWithOverflow.releaseIdleOverflowMemory());
+
+    EXPECT_THAT(static_cast<uint64_t>(std::count(overflowChunk, overflowChunk + pageSize, static_cast<uint8_t>(0U))),
+                Eq(pageSize));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iox/bump_allocator.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/expected.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
@@ -109,9 +110,19 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(iox::optional<iox::Path>, mountPoint, iox::nullopt)
+
       public:
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
+            if (m_mountPoint)
+            {
+                mountPointOfLastCreation = m_mountPoint;
+                if (creationWithMountPointFails)
+                {
+                    return iox::err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
+                }
+            }
             return iox::ok(SharedMemoryObject_MOCK(m_name,
                                                    m_memorySizeInBytes,
                                                    m_accessMode,
@@ -119,6 +130,9 @@ class MePooSegment_test : public Test
                                                    (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                                                    m_permissions));
         }
+
+        static bool creationWithMountPointFails;
+        static iox::optional<iox::Path> mountPointOfLastCreation;
     };
 
     MePooConfig setupMepooConfig()
@@ -134,6 +148,22 @@ class MePooSegment_test : public Test
 
     MePooConfig mepooConfig = setupMepooConfig();
 
+    void TearDown() override
+    {
+        SharedMemoryObject_MOCKBuilder::creationWithMountPointFails = false;
+        SharedMemoryObject_MOCKBuilder::mountPointOfLastCreation.reset();
+    }
+
+    HugePageConfig createHugePageConfig()
+    {
+        HugePageConfig hugePageConfig;
+        hugePageConfig.m_pageSize = HUGE_PAGE_SIZE;
+        hugePageConfig.m_mountPoint = Path::create("/dev/hugepages").expect("valid path");
+        return hugePageConfig;
+    }
+
+    static constexpr uint64_t HUGE_PAGE_SIZE{64U * 1024U};
+
     using SUT = MePooSegment<SharedMemoryObject_MOCK, MemoryManager>;
     std::unique_ptr<SUT> createSut()
     {
@@ -145,6 +175,8 @@ class MePooSegment_test : public Test
     }
 };
 MePooSegment_test::SharedMemoryObject_MOCK::createFct MePooSegment_test::SharedMemoryObject_MOCK::createVerificator;
+bool MePooSegment_test::SharedMemoryObject_MOCKBuilder::creationWithMountPointFails{false};
+iox::optional<iox::Path> MePooSegment_test::SharedMemoryObject_MOCKBuilder::mountPointOfLastCreation;
 
 TEST_F(MePooSegment_test, SharedMemoryFileHandleRightsAfterConstructor)
 {
@@ -226,4 +258,55 @@ TEST_F(MePooSegment_test, GetMemoryManager)
         .or_else([](auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
 }
 
+TEST_F(MePooSegment_test, SegmentWithoutHugePagesUsesTheSystemPageSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0a2f8c-3b7e-4c1a-9e6f-4a2d8b1c0e73");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    auto sut = createSut();
+    EXPECT_THAT(sut->getPageSize(), Eq(detail::pageSize()));
+    EXPECT_FALSE(sut->getHugePageMountPoint().has_value());
+    EXPECT_FALSE(SharedMemoryObject_MOCKBuilder::mountPointOfLastCreation.has_value());
+}
+
+TEST_F(MePooSegment_test, SegmentWithHugePagesIsCreatedInTheHugePageMountPoint)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e4c2a9-6f1d-4a3b-8c5e-0d9f2a7b3e16");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            createHugePageConfig()};
+
+    EXPECT_THAT(sut.getPageSize(), Eq(HUGE_PAGE_SIZE));
+    ASSERT_TRUE(sut.getHugePageMountPoint().has_value());
+    EXPECT_TRUE(sut.getHugePageMountPoint()->as_string() == "/dev/hugepages");
+    EXPECT_THAT(sut.getSegmentSize() % HUGE_PAGE_SIZE, Eq(0U));
+    EXPECT_THAT(sut.getSegmentSize(), Ge(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+}
+
+TEST_F(MePooSegment_test, SegmentWithHugePagesFallsBackToRegularPagesWhenHugePagesAreNotAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2c8f1e6b-9a4d-4b7e-a3c0-5e1b7d9f4a28");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SharedMemoryObject_MOCKBuilder::creationWithMountPointFails = true;
+    SUT sut{mepooConfig,
+            DEFAULT_DOMAIN_ID,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            createHugePageConfig()};
+
+    EXPECT_TRUE(SharedMemoryObject_MOCKBuilder::mountPointOfLastCreation.has_value());
+    EXPECT_THAT(sut.getPageSize(), Eq(detail::pageSize()));
+    EXPECT_FALSE(sut.getHugePageMountPoint().has_value());
+    EXPECT_THAT(sut.getSegmentSize(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+}
+
 } // namespace
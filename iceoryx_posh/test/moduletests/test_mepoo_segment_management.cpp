@@ -45,7 +45,9 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
                      const PosixGroup& readerGroup [[maybe_unused]],
                      const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const HugePageConfig& hugePageConfig [[maybe_unused]],
+                     const iox::optional<uint32_t> numaNode [[maybe_unused]]) noexcept
     {
     }
 };
@@ -180,6 +180,32 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.cloneToSharedChunk());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnSutWithLiveChunkResultsInNotEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "16338277-7727-4fd0-85df-23b1155acf47");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    sharedChunk = SharedChunk();
+
+    auto clonedSharedChunk = sut.tryCloneToSharedChunk();
+    EXPECT_TRUE(clonedSharedChunk);
+
+    sut.releaseToSharedChunk();
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 1U);
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnStaleCopyOfReleasedChunkResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57b8c8dd-7b97-4af4-bf84-3c64aa177fde");
+    ShmSafeUnmanagedChunk sut(getChunkFromMemoryManager());
+    auto staleCopy = sut;
+    sut.releaseToSharedChunk();
+
+    EXPECT_FALSE(staleCopy.tryCloneToSharedChunk());
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+}
+
 TEST_F(ShmSafeUnmanagedChunk_test, CallGetChunkHeaderOnNonConstDefaultConstructedSutResultsInNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ca9d879c-73e5-466f-a84c-356719b660f5");
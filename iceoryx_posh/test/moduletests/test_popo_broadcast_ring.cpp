@@ -0,0 +1,304 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_reader.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_writer.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+class BroadcastRing_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void TearDown() override
+    {
+        writer.releaseAll();
+    }
+
+    SharedChunk allocateChunk(const uint64_t value)
+    {
+        auto chunkSettings =
+            ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t)).expect("Valid 'ChunkSettings'");
+        auto chunk = memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        *static_cast<uint64_t*>(chunk.getUserPayload()) = value;
+        return chunk;
+    }
+
+    static uint64_t getChunkValue(const SharedChunk& chunk)
+    {
+        return *static_cast<const uint64_t*>(chunk.getUserPayload());
+    }
+
+    uint64_t getNumberOfUsedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint64_t RING_CAPACITY{4U};
+
+    MemoryManager memoryManager;
+    BroadcastRingData ringData{RING_CAPACITY};
+    BroadcastRingWriter writer{&ringData};
+    BroadcastRingCursorData cursorData;
+    BroadcastRingReader reader{&cursorData};
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint64_t CHUNK_SIZE = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+TEST_F(BroadcastRing_test, CapacityIsLimitedToMaximumCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e08d21d-c07c-4564-95d9-fd451ade0fa2");
+    BroadcastRingData tooLargeRingData{iox::MAX_BROADCAST_RING_CAPACITY + 1U};
+
+    EXPECT_THAT(BroadcastRingWriter(&tooLargeRingData).getCapacity(), Eq(iox::MAX_BROADCAST_RING_CAPACITY));
+}
+
+TEST_F(BroadcastRing_test, NotAttachedReaderIsEmptyAndGetsNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47dac57c-b785-4c84-af63-143b5e530728");
+    writer.push(allocateChunk(42U));
+
+    EXPECT_TRUE(reader.empty());
+    EXPECT_THAT(reader.size(), Eq(0U));
+    EXPECT_FALSE(reader.tryPop().has_value());
+}
+
+TEST_F(BroadcastRing_test, AttachedReaderGetsChunksInOrderOfPush)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "248eb26d-b8c1-4476-84fe-1304daaa7927");
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    EXPECT_TRUE(writer.isAttached(cursorData));
+
+    for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+    {
+        writer.push(allocateChunk(i));
+    }
+    EXPECT_THAT(reader.size(), Eq(RING_CAPACITY));
+
+    for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+    {
+        auto chunk = reader.tryPop();
+        ASSERT_TRUE(chunk.has_value());
+        EXPECT_THAT(getChunkValue(chunk.value()), Eq(i));
+    }
+    EXPECT_TRUE(reader.empty());
+    EXPECT_FALSE(reader.tryPop().has_value());
+    EXPECT_FALSE(reader.hasLostChunks());
+}
+
+TEST_F(BroadcastRing_test, EveryReaderReadsTheChunksWithItsOwnCursor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa34c1f8-69d5-441c-8863-578bb01ff6e3");
+    BroadcastRingCursorData otherCursorData;
+    BroadcastRingReader otherReader{&otherCursorData};
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    ASSERT_TRUE(writer.attach(otherCursorData, 0U));
+
+    writer.push(allocateChunk(1U));
+    writer.push(allocateChunk(2U));
+
+    auto chunk = reader.tryPop();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(getChunkValue(chunk.value()), Eq(1U));
+
+    auto otherChunk = otherReader.tryPop();
+    ASSERT_TRUE(otherChunk.has_value());
+    EXPECT_THAT(getChunkValue(otherChunk.value()), Eq(1U));
+
+    EXPECT_THAT(reader.size(), Eq(1U));
+    EXPECT_THAT(otherReader.size(), Eq(1U));
+}
+
+TEST_F(BroadcastRing_test, OverwrittenChunksAreSkippedAndReportedAsLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66727978-1cb9-4cf5-b2a5-96e632052787");
+    constexpr uint64_t NUMBER_OF_OVERWRITTEN_CHUNKS{2U};
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+
+    for (uint64_t i = 0U; i < RING_CAPACITY + NUMBER_OF_OVERWRITTEN_CHUNKS; ++i)
+    {
+        writer.push(allocateChunk(i));
+    }
+    EXPECT_THAT(reader.size(), Eq(RING_CAPACITY));
+
+    auto chunk = reader.tryPop();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(getChunkValue(chunk.value()), Eq(NUMBER_OF_OVERWRITTEN_CHUNKS));
+    EXPECT_TRUE(reader.hasLostChunks());
+    EXPECT_FALSE(reader.hasLostChunks());
+}
+
+TEST_F(BroadcastRing_test, PushIntoFullRingReleasesTheOldestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5d61e19-3723-498c-9698-f5d99e126a23");
+    for (uint64_t i = 0U; i < 3U * RING_CAPACITY; ++i)
+    {
+        writer.push(allocateChunk(i));
+    }
+
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(RING_CAPACITY));
+}
+
+TEST_F(BroadcastRing_test, ChunkOfReaderStaysValidWhenItIsOverwrittenInTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "131b96fa-7a35-4305-85ec-dc9dac9add3e");
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    writer.push(allocateChunk(73U));
+    auto chunk = reader.tryPop();
+    ASSERT_TRUE(chunk.has_value());
+
+    for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+    {
+        writer.push(allocateChunk(i));
+    }
+
+    EXPECT_THAT(getChunkValue(chunk.value()), Eq(73U));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(RING_CAPACITY + 1U));
+}
+
+TEST_F(BroadcastRing_test, AttachWithHistoryStartsWithTheLatestChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f9657d9-465b-4316-879d-e1d1437fb5b3");
+    constexpr uint64_t NUMBER_OF_HISTORY_CHUNKS{2U};
+    for (uint64_t i = 0U; i < RING_CAPACITY; ++i)
+    {
+        writer.push(allocateChunk(i));
+    }
+
+    ASSERT_TRUE(writer.attach(cursorData, NUMBER_OF_HISTORY_CHUNKS));
+
+    EXPECT_THAT(reader.size(), Eq(NUMBER_OF_HISTORY_CHUNKS));
+    for (uint64_t i = RING_CAPACITY - NUMBER_OF_HISTORY_CHUNKS; i < RING_CAPACITY; ++i)
+    {
+        auto chunk = reader.tryPop();
+        ASSERT_TRUE(chunk.has_value());
+        EXPECT_THAT(getChunkValue(chunk.value()), Eq(i));
+    }
+    EXPECT_FALSE(reader.hasLostChunks());
+}
+
+TEST_F(BroadcastRing_test, AttachWithHistoryLargerThanPublishedChunksStartsWithFirstChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65520e3c-a0ea-4e62-ba8e-2b538cf6965b");
+    writer.push(allocateChunk(1U));
+
+    ASSERT_TRUE(writer.attach(cursorData, RING_CAPACITY));
+
+    EXPECT_THAT(reader.size(), Eq(1U));
+}
+
+TEST_F(BroadcastRing_test, AttachWithHistoryLargerThanCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a743198a-77e4-4c67-a56f-30850b7fa1c3");
+    EXPECT_FALSE(writer.attach(cursorData, RING_CAPACITY + 1U));
+    EXPECT_FALSE(writer.isAttached(cursorData));
+}
+
+TEST_F(BroadcastRing_test, AttachFailsWhenReaderIsAlreadyAttachedToAnotherRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7885722c-70c7-4be4-bcda-9ccfc173294b");
+    BroadcastRingData otherRingData{RING_CAPACITY};
+    BroadcastRingWriter otherWriter{&otherRingData};
+    ASSERT_TRUE(otherWriter.attach(cursorData, 0U));
+
+    EXPECT_FALSE(writer.attach(cursorData, 0U));
+    EXPECT_FALSE(writer.isAttached(cursorData));
+    EXPECT_TRUE(otherWriter.isAttached(cursorData));
+}
+
+TEST_F(BroadcastRing_test, DetachedReaderGetsNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c687710d-b5a0-4f10-8d61-b8f67806a699");
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    writer.push(allocateChunk(1U));
+
+    writer.detach(cursorData);
+
+    EXPECT_FALSE(writer.isAttached(cursorData));
+    EXPECT_TRUE(reader.empty());
+    EXPECT_FALSE(reader.tryPop().has_value());
+}
+
+TEST_F(BroadcastRing_test, DetachFromOtherRingKeepsReaderAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e88fba4-6c1c-43db-8cf9-73698b23f355");
+    BroadcastRingData otherRingData{RING_CAPACITY};
+    BroadcastRingWriter otherWriter{&otherRingData};
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+
+    otherWriter.detach(cursorData);
+
+    EXPECT_TRUE(writer.isAttached(cursorData));
+}
+
+TEST_F(BroadcastRing_test, ClearSkipsAllUnreadChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57091d74-c99a-4573-ae53-fa15ff0f7ff8");
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    writer.push(allocateChunk(1U));
+    writer.push(allocateChunk(2U));
+
+    reader.clear();
+
+    EXPECT_TRUE(reader.empty());
+    writer.push(allocateChunk(3U));
+    auto chunk = reader.tryPop();
+    ASSERT_TRUE(chunk.has_value());
+    EXPECT_THAT(getChunkValue(chunk.value()), Eq(3U));
+}
+
+TEST_F(BroadcastRing_test, ReleaseAllReleasesTheChunksAndReaderGetsNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "51c6c9c9-e9dc-48c5-8473-d15d88b711fd");
+    ASSERT_TRUE(writer.attach(cursorData, 0U));
+    writer.push(allocateChunk(1U));
+    writer.push(allocateChunk(2U));
+
+    writer.releaseAll();
+
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+    EXPECT_FALSE(reader.tryPop().has_value());
+    EXPECT_TRUE(reader.hasLostChunks());
+}
+
+} // namespace
@@ -18,6 +18,7 @@
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring_writer.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
@@ -35,6 +36,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -335,6 +337,47 @@ TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithMultipleAddedQueuesAndUnknown
         .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
 }
 
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithUnknownLastIndexAfterRemovingAndAddingQueuesReturnsIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65ad5303-f8ee-483c-9292-8fe1310ca12a");
+    constexpr uint32_t UNKNOWN_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> addedQueues;
+    for (uint32_t i = 0U; i < TestFixture::MAX_NUMBER_QUEUES; ++i)
+    {
+        addedQueues.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(addedQueues.back().get()).has_error());
+    }
+
+    // remove every third queue and fill the free slots with new queues in order to shift the indices of the queues
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> removedQueues;
+    for (uint32_t i = 0U; i < addedQueues.size(); i += 2U)
+    {
+        removedQueues.emplace_back(addedQueues[i]);
+        ASSERT_FALSE(sut.tryRemoveQueue(addedQueues[i].get()).has_error());
+        addedQueues.erase(addedQueues.begin() + i);
+    }
+    while (addedQueues.size() < TestFixture::MAX_NUMBER_QUEUES)
+    {
+        addedQueues.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(addedQueues.back().get()).has_error());
+    }
+
+    for (uint32_t i = 0U; i < addedQueues.size(); ++i)
+    {
+        sut.getQueueIndex(addedQueues[i]->m_uniqueId, UNKNOWN_QUEUE_INDEX)
+            .and_then([&](const auto& index) { EXPECT_THAT(index, Eq(i)); })
+            .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
+    }
+    for (const auto& queue : removedQueues)
+    {
+        EXPECT_FALSE(sut.getQueueIndex(queue->m_uniqueId, UNKNOWN_QUEUE_INDEX).has_value());
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithPreviouslyAddedQueueRemovedReturnsNoIndex)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7680b79d-8e72-4441-8038-fa5a3fdfd182");
@@ -485,6 +528,26 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, NotifyAllStoredQueuesNotifiesEveryQueueWithoutDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d436bac-e268-4d1f-a48b-e462535d1a13");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_THAT(sut.notifyAllStoredQueues(), Eq(2U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_THAT(queue.size(), Eq(0U));
+    EXPECT_THAT(queue2.size(), Eq(0U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -724,6 +787,35 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddAfterHistoryWrappedAroundDeliversNewestChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cc731284-4947-4d26-9ea4-be29af4bc40f");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const uint64_t NUMBER_OF_CHUNKS = 3U * this->HISTORY_SIZE + 5U;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(static_cast<uint32_t>(i)));
+    }
+
+    // the replaced chunks must have been released
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    ASSERT_THAT(queue.size(), Eq(this->HISTORY_SIZE));
+    for (uint64_t i = NUMBER_OF_CHUNKS - this->HISTORY_SIZE; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c0500dec-bbd8-4958-9545-a14ef68108a1");
@@ -822,4 +914,106 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverWithBroadcastRingWritesChunkOnceIntoTheRingForAttachedQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd989e72-7ad9-4039-a2f1-173bb4c2ce16");
+    BroadcastRingData broadcastRing{iox::MAX_BROADCAST_RING_CAPACITY};
+    auto sutData = this->getChunkDistributorData();
+    sutData->m_broadcastRing = &broadcastRing;
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4451U)), Eq(2U));
+
+    for (const auto& queueData : {queueData1, queueData2})
+    {
+        // the chunk is not pushed into the queue but read from the ring
+        EXPECT_TRUE(queueData->m_queue.empty());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        EXPECT_THAT(queue.size(), Eq(1U));
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4451U));
+    }
+
+    sut.removeAllQueues();
+    sut.cleanup();
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithBroadcastRingFromTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a852cd9-0d8f-4383-b33f-37705cd11231");
+    BroadcastRingData broadcastRing{iox::MAX_BROADCAST_RING_CAPACITY};
+    auto sutData = this->getChunkDistributorData();
+    sutData->m_broadcastRing = &broadcastRing;
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    sut.addToHistoryWithoutDelivery(this->allocateChunk(3U));
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 2U).has_error());
+
+    EXPECT_TRUE(queueData->m_queue.empty());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_THAT(queue.size(), Eq(2U));
+    for (uint32_t expectedValue : {2U, 3U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+
+    sut.removeAllQueues();
+    sut.cleanup();
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockingQueueIsNotAttachedToBroadcastRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ab805d0-e8f0-468a-ac3e-e799d741b9ff");
+    BroadcastRingData broadcastRing{iox::MAX_BROADCAST_RING_CAPACITY};
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    sutData->m_broadcastRing = &broadcastRing;
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER,
+                                             VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(42U)), Eq(1U));
+
+    EXPECT_FALSE(BroadcastRingWriter(&broadcastRing).isAttached(queueData->m_broadcastRingCursor));
+    EXPECT_THAT(queueData->m_queue.size(), Eq(1U));
+
+    sut.removeAllQueues();
+    sut.cleanup();
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueDetachesItFromBroadcastRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ee7f1faf-349e-41a1-a0e6-d13f5f843801");
+    BroadcastRingData broadcastRing{iox::MAX_BROADCAST_RING_CAPACITY};
+    auto sutData = this->getChunkDistributorData();
+    sutData->m_broadcastRing = &broadcastRing;
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_TRUE(BroadcastRingWriter(&broadcastRing).isAttached(queueData->m_broadcastRingCursor));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(BroadcastRingWriter(&broadcastRing).isAttached(queueData->m_broadcastRingCursor));
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.empty());
+
+    sut.cleanup();
+}
+
 } // namespace
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/chunk_ownership_ledger.hpp"
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+class ChunkOwnershipLedger_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+
+        iox::BumpAllocator memoryAllocator{m_memory.get(), MEMORY_SIZE};
+        memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+    }
+
+    SharedChunk getChunkFromMemoryManager()
+    {
+        constexpr uint64_t USER_PAYLOAD_SIZE{32U};
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                .expect("Valid 'ChunkSettings'");
+
+        return memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+    }
+
+    /// @brief simulates the termination of the application by dropping the SharedChunk without releasing its reference
+    void terminateApplication(SharedChunk& chunk)
+    {
+        chunk.release();
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL{10U};
+    static constexpr uint64_t CHUNK_SIZE{128U};
+    static constexpr uint32_t LEDGER_CAPACITY{4U};
+
+    MemoryManager memoryManager;
+    ChunkOwnershipLedger<LEDGER_CAPACITY> sut;
+
+  private:
+    static constexpr size_t MEGABYTE = 1U << 20U;
+    static constexpr size_t MEMORY_SIZE = 4U * MEGABYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+};
+
+TEST_F(ChunkOwnershipLedger_test, RecordingChunkKeepsReferenceWithSharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "141218f1-84cd-43e4-8a65-ccd24a8436d9");
+    {
+        auto chunk = getChunkFromMemoryManager();
+        sut.record(chunk);
+
+        EXPECT_TRUE(chunk);
+        EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+        sut.clear();
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut.cleanup(), Eq(0U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_leakedChunks, Eq(0U));
+}
+
+TEST_F(ChunkOwnershipLedger_test, CleanupReleasesRecordedChunkOfTerminatedApplication)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "574896e2-6609-4484-924d-7699842b8324");
+    auto chunk = getChunkFromMemoryManager();
+    sut.record(chunk);
+    terminateApplication(chunk);
+
+    EXPECT_THAT(sut.cleanup(), Eq(1U));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_leakedChunks, Eq(1U));
+}
+
+TEST_F(ChunkOwnershipLedger_test, CleanupReleasesMultipleRecordedChunksOfTerminatedApplication)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ede83548-7ea2-4621-a816-a9533849dd2a");
+    SharedChunk chunks[LEDGER_CAPACITY];
+    for (auto& chunk : chunks)
+    {
+        chunk = getChunkFromMemoryManager();
+    }
+    sut.record(chunks, LEDGER_CAPACITY);
+    for (auto& chunk : chunks)
+    {
+        terminateApplication(chunk);
+    }
+
+    EXPECT_THAT(sut.cleanup(), Eq(LEDGER_CAPACITY));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_leakedChunks, Eq(LEDGER_CAPACITY));
+}
+
+TEST_F(ChunkOwnershipLedger_test, ClearedRecordsAreNotReleasedByCleanup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b468c089-98dd-4e94-b16f-4340a2c6a45c");
+    auto handedOverChunk = getChunkFromMemoryManager();
+    sut.record(handedOverChunk);
+    sut.clear();
+
+    auto chunkInTransit = getChunkFromMemoryManager();
+    sut.record(chunkInTransit);
+    terminateApplication(chunkInTransit);
+
+    EXPECT_THAT(sut.cleanup(), Eq(1U));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(1U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_leakedChunks, Eq(1U));
+}
+} // namespace
@@ -30,6 +30,9 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -277,6 +280,30 @@ class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
                                  iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
+
+    ChunkQueueData_t m_blockingChunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                                         iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> m_blockingPopper{&m_blockingChunkData};
+    ChunkQueuePusher<ChunkQueueData_t> m_blockingPusher{&m_blockingChunkData};
+
+    void fillBlockingQueue()
+    {
+        for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+        {
+            EXPECT_TRUE(m_blockingPusher.push(allocateChunk()));
+        }
+    }
+
+    void waitUntilProducerIsWaiting()
+    {
+        while (m_blockingChunkData.m_numberOfWaitingProducers.load() == 0U)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    static constexpr iox::units::Duration LONG_TIMEOUT{10_s};
+    static constexpr std::chrono::seconds MAX_WAKE_UP_DURATION{5};
 };
 
 TYPED_TEST(ChunkQueueFiFo_test, InitialSize)
@@ -323,6 +350,59 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, WaitUntilNotFullReturnsImmediatelyWhenQueueIsNotFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0a63527-e713-4a33-97f5-c427f0a1055f");
+    const auto start = std::chrono::steady_clock::now();
+
+    this->m_blockingPusher.waitUntilNotFull(this->LONG_TIMEOUT);
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(this->MAX_WAKE_UP_DURATION));
+    EXPECT_THAT(this->m_blockingChunkData.m_numberOfWaitingProducers.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, WaitUntilNotFullReturnsAfterTimeoutWhenQueueStaysFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9342c5eb-7c94-49e9-922d-6b33888a954c");
+    this->fillBlockingQueue();
+    const auto start = std::chrono::steady_clock::now();
+
+    this->m_blockingPusher.waitUntilNotFull(10_ms);
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Ge(std::chrono::milliseconds(10)));
+    this->m_blockingPopper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, WaitingProducerIsWokenUpWhenChunkIsPopped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ef0e7161-34d4-4c07-81d1-e9fa477cb319");
+    this->fillBlockingQueue();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&] { this->m_blockingPusher.waitUntilNotFull(this->LONG_TIMEOUT); });
+    this->waitUntilProducerIsWaiting();
+    EXPECT_TRUE(this->m_blockingPopper.tryPop().has_value());
+    producer.join();
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(this->MAX_WAKE_UP_DURATION));
+    this->m_blockingPopper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, WaitingProducerIsWokenUpWithoutPoppedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9584d72f-5d7b-46ae-adc4-857e0f87dc2e");
+    this->fillBlockingQueue();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&] { this->m_blockingPusher.waitUntilNotFull(this->LONG_TIMEOUT); });
+    this->waitUntilProducerIsWaiting();
+    this->m_blockingPusher.wakeUpWaitingProducers();
+    producer.join();
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(this->MAX_WAKE_UP_DURATION));
+    this->m_blockingPopper.clear();
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
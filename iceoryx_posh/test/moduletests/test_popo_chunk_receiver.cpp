@@ -184,6 +184,83 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c18c2b7-ce2e-44e5-9ef0-36ebd0975b60");
+    const iox::mepoo::ChunkHeader* chunkHeaders[4U];
+    auto getResult = m_chunkReceiver.tryGetBatch(&chunkHeaders[0], 4U);
+    ASSERT_TRUE(getResult.has_error());
+    EXPECT_EQ(getResult.error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
+TEST_F(ChunkReceiver_test, getBatchProvidesChunksInQueueOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86074ffd-a89e-44a5-8b2a-e1d9a224955b");
+    constexpr uint32_t NUMBER_OF_PUSHED_CHUNKS{5U};
+    constexpr uint32_t MAX_NUMBER_OF_CHUNKS{8U};
+    for (uint32_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample{i};
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[MAX_NUMBER_OF_CHUNKS];
+    auto getResult = m_chunkReceiver.tryGetBatch(&chunkHeaders[0], MAX_NUMBER_OF_CHUNKS);
+    ASSERT_FALSE(getResult.has_error());
+    ASSERT_THAT(getResult.value(), Eq(NUMBER_OF_PUSHED_CHUNKS));
+    EXPECT_TRUE(m_chunkReceiver.empty());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_PUSHED_CHUNKS));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchIsLimitedByTheChunksHeldInParallel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86e4f17b-1941-4650-adbe-97a085ebc171");
+    constexpr uint32_t MAX_CHUNKS_IN_USE{ChunkReceiverData_t::MAX_CHUNKS_IN_USE};
+    const iox::mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_IN_USE];
+
+    // one chunk less than the number of chunks which can be held in parallel
+    for (uint32_t i = 0U; i < MAX_CHUNKS_IN_USE - 1U; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+    auto getResult = m_chunkReceiver.tryGetBatch(&chunkHeaders[0], MAX_CHUNKS_IN_USE);
+    ASSERT_FALSE(getResult.has_error());
+    EXPECT_THAT(getResult.value(), Eq(MAX_CHUNKS_IN_USE - 1U));
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    // only one more chunk is taken, the other one stays in the queue
+    getResult = m_chunkReceiver.tryGetBatch(&chunkHeaders[0], 2U);
+    ASSERT_FALSE(getResult.has_error());
+    EXPECT_THAT(getResult.value(), Eq(1U));
+    EXPECT_FALSE(m_chunkReceiver.empty());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAX_CHUNKS_IN_USE + 1U));
+
+    // like with tryGet, the next chunk is dropped if the application holds too many chunks
+    getResult = m_chunkReceiver.tryGetBatch(&chunkHeaders[0], 2U);
+    ASSERT_TRUE(getResult.has_error());
+    EXPECT_THAT(getResult.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_TRUE(m_chunkReceiver.empty());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAX_CHUNKS_IN_USE));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
@@ -435,6 +435,63 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9d4f3c26-0b8e-4e51-8f7a-2c6e1d5b9a43");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY < NUM_CHUNKS_IN_POOL
+                                            ? iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY
+                                            : NUM_CHUNKS_IN_POOL};
+
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    ASSERT_FALSE(m_chunkSender
+                     .tryAllocateBatch(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                       sizeof(DummySample),
+                                       alignof(DummySample),
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT,
+                                       &chunkHeaders[0],
+                                       NUMBER_OF_CHUNKS)
+                     .has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        new (chunkHeaders[i]->userPayload()) DummySample();
+        static_cast<DummySample*>(chunkHeaders[i]->userPayload())->dummy = i;
+    }
+
+    EXPECT_THAT(m_chunkSender.sendBatch(&chunkHeaders[0], NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> checkQueue(&m_chunkQueueData);
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = checkQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(checkQueue.empty());
+}
+
+TEST_F(ChunkSender_test, allocateBatchWithMoreChunksThanAllowedToBeAllocatedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7b2a5d1-4c93-4f6e-b8a0-61d3f9c2e574");
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    auto result = m_chunkSender.tryAllocateBatch(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                 sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT,
+                                                 &chunkHeaders[0],
+                                                 NUMBER_OF_CHUNKS);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -805,6 +862,57 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, ReleaseAllReturnsTheChunksCachedInTheChunkMagazine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0abee68a-1a59-4d1d-be73-74542f2818ec");
+    constexpr bool USE_CHUNK_MAGAZINE{true};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      USE_CHUNK_MAGAZINE};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader = sut.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                            SMALL_CHUNK,
+                                            USER_PAYLOAD_ALIGNMENT,
+                                            USER_HEADER_SIZE,
+                                            USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(iox::mepoo::MemPoolMagazine::CAPACITY));
+
+    sut.release(maybeChunkHeader.value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(iox::mepoo::MemPoolMagazine::CAPACITY - 1U));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, ReleaseAllReclaimsChunksInTransitAndAccountsThemAsLeaked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e60041ff-86f3-4062-94df-a930a25f1916");
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      SMALL_CHUNK,
+                                                      USER_PAYLOAD_ALIGNMENT,
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    // simulate an application which terminated while the chunk was neither in the mempool nor in the UsedChunkList
+    auto chunkSettings =
+        iox::mepoo::ChunkSettings::create(SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT).expect("Valid 'ChunkSettings'");
+    auto chunkInTransit = m_memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+    m_chunkSenderData.m_ownershipLedger.record(chunkInTransit);
+    chunkInTransit.release();
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+
+    m_chunkSender.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_leakedChunks, Eq(1U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -58,6 +58,22 @@ class ConditionVariable_test : public Test
         m_watchdog.watchAndActOnFailure([&] { std::terminate(); });
     }
 
+    /// @brief returns the number of futex wake-ups or, without futex, the number of posts which are still pending
+    uint64_t numberOfWakeUpSignals()
+    {
+        if (IOX_FUTEX_AVAILABLE)
+        {
+            return m_condVarData.m_wakeUpGeneration.load();
+        }
+
+        uint64_t numberOfPendingPosts{0U};
+        while (m_condVarData.m_semaphore->tryWait().expect("valid semaphore"))
+        {
+            ++numberOfPendingPosts;
+        }
+        return numberOfPendingPosts;
+    }
+
     Watchdog m_watchdog{m_timeToWait};
 };
 
@@ -131,13 +147,42 @@ TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThread
     waiter.join();
 }
 
+TEST_F(ConditionVariable_test, NotifyDoesNotWakeUpWhenListenerIsNotWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69e413df-c49a-47cf-a5db-f7ea0f832e90");
+    m_signaler.notify();
+    m_signaler.notify();
+    m_notifiers[1U].notify();
+
+    EXPECT_TRUE(m_waiter.wasNotified());
+    EXPECT_THAT(numberOfWakeUpSignals(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, BurstOfNotificationsWakesUpWaitingListenerOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "291dd8b4-530f-4f30-8fc3-20a44a9c297b");
+    std::thread waiter([&] { EXPECT_FALSE(m_waiter.wait().empty()); });
+    while (!m_condVarData.m_isListenerWaiting.load())
+    {
+        std::this_thread::yield();
+    }
+
+    m_signaler.notify();
+    m_signaler.notify();
+    m_notifiers[1U].notify();
+    waiter.join();
+
+    // the listener may have collected the notification before it blocked, then the wake-up was not necessary
+    EXPECT_THAT(numberOfWakeUpSignals(), Le(1U));
+}
+
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +195,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification.load(), Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,11 +211,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i].load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
@@ -233,6 +278,27 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
     }
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAtWordBoundariesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cccbbe6e-ac6e-46ca-a1cf-7f373c49752f");
+    constexpr uint64_t NUMBER_OF_NOTIFIED_INDICES{5U};
+    const uint64_t notifiedIndices[NUMBER_OF_NOTIFIED_INDICES]{
+        0U, 63U, 64U, iox::MAX_NUMBER_OF_NOTIFIERS - 64U, iox::MAX_NUMBER_OF_NOTIFIERS - 1U};
+    for (auto i = NUMBER_OF_NOTIFIED_INDICES; i > 0U; --i)
+    {
+        ConditionNotifier(m_condVarData, notifiedIndices[i - 1U]).notify();
+    }
+
+    auto indices = m_waiter.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(NUMBER_OF_NOTIFIED_INDICES));
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFIED_INDICES; ++i)
+    {
+        EXPECT_THAT(indices[i], Eq(notifiedIndices[i]));
+    }
+    EXPECT_THAT(m_condVarData.m_activeNotificationWords.load(), Eq(0U));
+}
+
 TIMING_TEST_F(ConditionVariable_test, TimedWaitBlocksUntilTimeout, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "c755aec9-43c3-4bf4-bec4-5672c76561ef");
     ConditionListener listener(m_condVarData);
@@ -420,9 +486,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
         {
-            EXPECT_THAT(notification.load(), Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/fatal_failure.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iox/detail/hoofs_error_reporting.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+using namespace iox::testing;
+
+class DiscoveryNotifier_test : public Test
+{
+  public:
+    bool isChanged(const uint64_t portIndex) const
+    {
+        const auto word = m_data.m_changedPorts[portIndex / DiscoveryNotificationData::PORTS_PER_WORD].load();
+        return (word & (1ULL << (portIndex % DiscoveryNotificationData::PORTS_PER_WORD))) != 0U;
+    }
+
+    DiscoveryNotificationData m_data;
+};
+
+TEST_F(DiscoveryNotifier_test, InitiallyNoPortIsChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba540a08-35eb-4aa3-a5c7-eeb5db1b9ff3");
+    for (uint64_t portIndex = 0U; portIndex < DiscoveryNotificationData::NUMBER_OF_PORTS; ++portIndex)
+    {
+        EXPECT_FALSE(isChanged(portIndex));
+    }
+}
+
+TEST_F(DiscoveryNotifier_test, NotifyMarksOnlyTheNotifyingPortAsChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "60fcd3d8-5263-4fc4-8f18-99f9b8bc142d");
+    const uint64_t firstPortIndex{DiscoveryNotificationData::SUBSCRIBER_OFFSET};
+    const uint64_t lastPortIndex{DiscoveryNotificationData::NUMBER_OF_PORTS - 1U};
+
+    DiscoveryNotifier(m_data, firstPortIndex).notify();
+    DiscoveryNotifier(m_data, lastPortIndex).notify();
+
+    for (uint64_t portIndex = 0U; portIndex < DiscoveryNotificationData::NUMBER_OF_PORTS; ++portIndex)
+    {
+        EXPECT_THAT(isChanged(portIndex), Eq(portIndex == firstPortIndex || portIndex == lastPortIndex));
+    }
+}
+
+TEST_F(DiscoveryNotifier_test, NotifyWakesUpTheDiscoveryLoopWithThePortNotificationIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab3a0ea9-cd4b-4079-b4a9-4df9c642f441");
+    ConditionListener sut{m_data.m_conditionVariableData};
+
+    DiscoveryNotifier(m_data, DiscoveryNotificationData::CLIENT_OFFSET).notify();
+
+    auto notifications = sut.timedWait(1_s);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(DiscoveryNotificationData::PORT_NOTIFICATION_INDEX));
+}
+
+TEST_F(DiscoveryNotifier_test, CreatingNotifierWithOutOfRangePortIndexLeadsToFatalFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63873557-9aaa-4ad6-995b-62f3ba080dca");
+    IOX_EXPECT_FATAL_FAILURE([&] { DiscoveryNotifier(m_data, DiscoveryNotificationData::NUMBER_OF_PORTS); },
+                             iox::er::ENFORCE_VIOLATION);
+}
+
+} // namespace
@@ -25,6 +25,7 @@ namespace
 {
 using namespace ::testing;
 using ::testing::_;
+using iox::popo::AllocationError;
 
 struct DummyData
 {
@@ -274,6 +275,80 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchReturnsDefaultInitializedSamplesInTheOrderOfTheAllocatedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97be0513-2dfe-4b6b-93c6-53a7ff42af3b");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, 2U, sizeof(DummyData), _, _, _))
+        .WillOnce(Invoke([&](auto chunkHeaders, auto, auto, auto, auto, auto) -> iox::expected<void, AllocationError> {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().size(), 2U);
+    EXPECT_EQ(result.value()[0].getChunkHeader(), chunkMock.chunkHeader());
+    EXPECT_EQ(result.value()[1].getChunkHeader(), secondChunkMock.chunkHeader());
+    EXPECT_EQ(result.value()[0]->val, DummyData::defaultVal());
+    EXPECT_EQ(result.value()[1]->val, DummyData::defaultVal());
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchFailsWhenThePortCannotAllocateAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c6709faf-eafb-4cde-b04e-b2ebb57e02b9");
+    EXPECT_CALL(portMock, tryAllocateChunks(_, 3U, sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::err(AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(3U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), AllocationError::RUNNING_OUT_OF_CHUNKS);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchWithMoreSamplesThanAllowedToBeAllocatedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15c1bc87-af24-4660-a960-0740189f6aa0");
+    EXPECT_CALL(portMock, tryAllocateChunks(_, _, _, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllChunksWithOneCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8db1a5f5-a498-4755-ae6d-c302bfcd7f33");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, 2U, sizeof(DummyData), _, _, _))
+        .WillOnce(Invoke([&](auto chunkHeaders, auto, auto, auto, auto, auto) -> iox::expected<void, AllocationError> {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    auto result = sut.loanBatch(2U);
+    ASSERT_FALSE(result.has_error());
+
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](auto chunkHeaders, auto) {
+            EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+            EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    sut.publishBatch(std::move(result.value()));
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
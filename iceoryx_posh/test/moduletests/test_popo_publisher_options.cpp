@@ -32,6 +32,8 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.useChunkMagazine = true;
+    testOptions.broadcastRingCapacity = 13;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +48,12 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.useChunkMagazine, Ne(defaultOptions.useChunkMagazine));
+            EXPECT_THAT(roundTripOptions.useChunkMagazine, Eq(testOptions.useChunkMagazine));
+
+            EXPECT_THAT(roundTripOptions.broadcastRingCapacity, Ne(defaultOptions.broadcastRingCapacity));
+            EXPECT_THAT(roundTripOptions.broadcastRingCapacity, Eq(testOptions.broadcastRingCapacity));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -62,7 +62,7 @@ class PublisherPort_test : public Test
 
     static constexpr size_t MEMORY_SIZE = 1024 * 1024;
     uint8_t m_memory[MEMORY_SIZE];
-    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20U + static_cast<uint32_t>(iox::MAX_PUBLISHER_HISTORY);
     static constexpr uint64_t SMALL_CHUNK = 128;
     static constexpr uint64_t BIG_CHUNK = 256;
 
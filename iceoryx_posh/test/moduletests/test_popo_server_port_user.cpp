@@ -376,6 +376,47 @@ TEST_F(ServerPort_test, GetRequestWhenProcessingTooManyRequestsInParallelResults
         });
 }
 
+TEST_F(ServerPort_test, GetRequestsWithoutOfferResultsInNoPendingRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1082b434-6b93-4465-9d59-f3d614d9f9c8");
+    auto& sut = serverPortWithoutOfferOnCreate;
+
+    const RequestHeader* requestHeaders[2U];
+    sut.portUser.getRequests(&requestHeaders[0], 2U)
+        .and_then([&](const auto&) {
+            GTEST_FAIL() << "Expected ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER but "
+                            "got requests";
+        })
+        .or_else([&](const auto& error) {
+            EXPECT_THAT(error, Eq(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER));
+        });
+}
+
+TEST_F(ServerPort_test, GetRequestsWithMultipleRequestsResultsInRequestHeadersInQueueOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b69dbd67-686c-4b41-a581-4bdd53edc1b0");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t REQUEST_DATA_BASE{37};
+
+    constexpr uint32_t NUMBER_OF_REQUESTS{3U};
+    constexpr uint32_t MAX_NUMBER_OF_REQUESTS{5U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS, REQUEST_DATA_BASE);
+
+    const RequestHeader* requestHeaders[MAX_NUMBER_OF_REQUESTS];
+    sut.portUser.getRequests(&requestHeaders[0], MAX_NUMBER_OF_REQUESTS)
+        .and_then([&](const auto& numberOfRequests) {
+            ASSERT_THAT(numberOfRequests, Eq(NUMBER_OF_REQUESTS));
+            for (uint32_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+            {
+                EXPECT_THAT(this->getRequestData(requestHeaders[i]), Eq(REQUEST_DATA_BASE + i));
+            }
+        })
+        .or_else([&](const auto& error) { GTEST_FAIL() << "Expected RequestHeaders but got error: " << error; });
+
+    EXPECT_FALSE(sut.portUser.hasNewRequests());
+}
+
 // END getRequest tests
 
 // BEGIN releaseRequest tests
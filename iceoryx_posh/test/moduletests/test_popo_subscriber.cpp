@@ -177,6 +177,31 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchReturnsTheTakenChunksWrappedInSamples)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5bdd4125-85d0-4d5e-b0b0-8f132cac2900");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks(_, 4U))
+        .Times(1)
+        .WillOnce(Invoke([&](const iox::mepoo::ChunkHeader** const chunkHeaders, const uint32_t) {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::expected<uint32_t, iox::popo::ChunkReceiveResult>(iox::ok(2U));
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    {
+        auto maybeSamples = sut.takeBatch(4U);
+        // ===== Verify ===== //
+        ASSERT_FALSE(maybeSamples.has_error());
+        ASSERT_THAT(maybeSamples.value().size(), Eq(2U));
+        EXPECT_EQ(maybeSamples.value()[0].get(), chunkMock.chunkHeader()->userPayload());
+        EXPECT_EQ(maybeSamples.value()[1].get(), secondChunkMock.chunkHeader()->userPayload());
+    }
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
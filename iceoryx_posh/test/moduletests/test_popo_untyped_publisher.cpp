@@ -137,6 +137,61 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanBatchProvidesTheUserPayloadsOfTheAllocatedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ed63f260-fec5-483b-9ceb-0a6e68d522bb");
+    constexpr uint64_t ALLOCATION_SIZE = 7U;
+    ChunkMock<uint64_t> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, 2U, ALLOCATION_SIZE, _, _, _))
+        .WillOnce(Invoke(
+            [&](auto chunkHeaders, auto, auto, auto, auto, auto) -> iox::expected<void, iox::popo::AllocationError> {
+                chunkHeaders[0] = chunkMock.chunkHeader();
+                chunkHeaders[1] = secondChunkMock.chunkHeader();
+                return iox::ok();
+            }));
+    // ===== Test ===== //
+    void* userPayloads[2U]{nullptr, nullptr};
+    auto result = sut.loanBatch(&userPayloads[0], 2U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanBatchFailsIfPortCannotSatisfyAllocationRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bb2a3a08-0fea-4891-9154-b27997caf952");
+    constexpr uint64_t ALLOCATION_SIZE = 17U;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, 2U, ALLOCATION_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    void* userPayloads[2U]{nullptr, nullptr};
+    auto result = sut.loanBatch(&userPayloads[0], 2U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    EXPECT_EQ(userPayloads[0], nullptr);
+    EXPECT_EQ(userPayloads[1], nullptr);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithOneCallViaUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66accd54-7a7f-48b4-a6a3-d9916f4f6c74");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    void* userPayloads[2U]{chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    EXPECT_CALL(portMock, sendChunks(_, 2U)).WillOnce(Invoke([&](auto chunkHeaders, auto) {
+        EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+        EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+    }));
+    // ===== Test ===== //
+    sut.publishBatch(&userPayloads[0], 2U);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -159,6 +159,32 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeChunksProvidesTheUserPayloadsOfTheTakenChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8418feea-bd23-4b2b-8be0-9a2b3777ad88");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(sut, takeChunks(_, 4U))
+        .Times(1)
+        .WillOnce(Invoke([&](const iox::mepoo::ChunkHeader** const chunkHeaders, const uint32_t) {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::expected<uint32_t, iox::popo::ChunkReceiveResult>(iox::ok(2U));
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    const void* userPayloads[4U];
+    auto takeResult = sut.takeChunks(&userPayloads[0], 4U);
+    // ===== Verify ===== //
+    ASSERT_FALSE(takeResult.has_error());
+    ASSERT_THAT(takeResult.value(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], secondChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+    sut.release(userPayloads[0]);
+    sut.release(userPayloads[1]);
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
@@ -23,6 +23,8 @@
 
 #include "test.hpp"
 
+#include <random>
+
 namespace
 {
 using namespace ::testing;
@@ -121,6 +123,66 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, MultipleChunksCanBeAddedAtOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7de8d4f8-3dc1-4a60-9456-8da3431d851d");
+    SharedChunk chunks[USED_CHUNK_LIST_CAPACITY];
+    for (auto& chunk : chunks)
+    {
+        chunk = getChunkFromMemoryManager();
+    }
+
+    EXPECT_TRUE(sut.insert(&chunks[0], USED_CHUNK_LIST_CAPACITY));
+
+    for (auto& chunk : chunks)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_TRUE(removedChunk == chunk);
+    }
+}
+
+TEST_F(UsedChunkList_test, AddingMultipleChunksAtOnceWhichDoNotFitAddsNoneOfThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "21bcec0d-4614-481f-8d48-9c16b3451687");
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY - NUMBER_OF_CHUNKS + 1U,
+                         [this](SharedChunk&& chunk) { EXPECT_TRUE(sut.insert(chunk)); });
+
+    SharedChunk chunks[NUMBER_OF_CHUNKS];
+    for (auto& chunk : chunks)
+    {
+        chunk = getChunkFromMemoryManager();
+    }
+
+    EXPECT_FALSE(sut.insert(&chunks[0], NUMBER_OF_CHUNKS));
+
+    for (auto& chunk : chunks)
+    {
+        SharedChunk removedChunk;
+        EXPECT_FALSE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    }
+    EXPECT_TRUE(sut.insert(&chunks[0], NUMBER_OF_CHUNKS - 1U));
+}
+
+TEST_F(UsedChunkList_test, NumberOfFreeEntriesFollowsInsertRemoveAndCleanup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20d4424d-1836-4bca-bdbe-6027dc161d8c");
+    EXPECT_THAT(sut.numberOfFreeEntries(), Eq(USED_CHUNK_LIST_CAPACITY));
+
+    auto chunk = getChunkFromMemoryManager();
+    sut.insert(chunk);
+    sut.insert(getChunkFromMemoryManager());
+    EXPECT_THAT(sut.numberOfFreeEntries(), Eq(USED_CHUNK_LIST_CAPACITY - 2U));
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_THAT(sut.numberOfFreeEntries(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+
+    sut.cleanup();
+    EXPECT_THAT(sut.numberOfFreeEntries(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -212,6 +274,42 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInArbitraryOrder)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, InterleavedInsertAndRemoveInRandomOrderFindsEveryChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5afe9caf-6529-47a3-a291-5594f0d75935");
+    constexpr uint32_t CAPACITY{64U};
+    constexpr uint32_t NUMBER_OF_OPERATIONS{2000U};
+    UsedChunkList<CAPACITY> largeSut;
+    std::vector<SharedChunk> chunksInUse;
+    std::mt19937 generator{42U};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+    {
+        const bool shallInsert = chunksInUse.empty() || (chunksInUse.size() < CAPACITY && generator() % 2U == 0U);
+        if (shallInsert)
+        {
+            chunksInUse.push_back(getChunkFromMemoryManager());
+            ASSERT_TRUE(largeSut.insert(chunksInUse.back()));
+        }
+        else
+        {
+            const auto index = generator() % chunksInUse.size();
+            SharedChunk removedChunk;
+            ASSERT_TRUE(largeSut.remove(chunksInUse[index].getChunkHeader(), removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse[index].getChunkHeader()));
+            chunksInUse.erase(chunksInUse.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+        ASSERT_THAT(largeSut.numberOfFreeEntries(), Eq(CAPACITY - chunksInUse.size()));
+    }
+
+    for (auto& chunk : chunksInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(largeSut.remove(chunk.getChunkHeader(), removedChunk));
+    }
+    EXPECT_THAT(largeSut.numberOfFreeEntries(), Eq(CAPACITY));
+}
+
 TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5932b727-dfbe-4041-985d-7a819c8ea06c");
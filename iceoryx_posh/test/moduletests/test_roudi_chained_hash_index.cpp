@@ -0,0 +1,168 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/chained_hash_index.hpp"
+
+#include "test.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class ChainedHashIndex_test : public Test
+{
+  public:
+    static constexpr uint32_t CAPACITY{16U};
+    using Sut_t = ChainedHashIndex<CAPACITY>;
+    static constexpr uint32_t NO_INDEX{Sut_t::NO_INDEX};
+    // the same hash for all keys in order to provoke collisions
+    static constexpr uint32_t COLLIDING_HASH{42U};
+
+    void insert(const uint32_t index, const uint32_t key, const uint32_t hash = COLLIDING_HASH)
+    {
+        keys[index] = key;
+        sut.insert(index, hash, [&](const uint32_t other) { return keys[other] == key; });
+    }
+
+    void remove(const uint32_t index)
+    {
+        const auto key = keys[index];
+        sut.remove(index, [&](const uint32_t other) { return keys[other] == key; });
+    }
+
+    Sut_t::Chain find(const uint32_t key, const uint32_t hash = COLLIDING_HASH) const
+    {
+        return sut.find(hash, [&](const uint32_t other) { return keys[other] == key; });
+    }
+
+    std::vector<uint32_t> chainOf(const uint32_t key, const uint32_t hash = COLLIDING_HASH) const
+    {
+        std::vector<uint32_t> indices;
+        for (auto index = find(key, hash).head; index != NO_INDEX; index = sut.next(index))
+        {
+            indices.push_back(index);
+        }
+        return indices;
+    }
+
+    uint32_t keys[CAPACITY]{};
+    Sut_t sut;
+};
+
+TEST_F(ChainedHashIndex_test, FindWithoutEntriesReturnsEmptyChain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c20a532-2b97-47fd-8d8e-0db5da7f1e1e");
+    const auto chain = find(1U);
+
+    EXPECT_THAT(chain.head, Eq(NO_INDEX));
+    EXPECT_THAT(chain.length, Eq(0U));
+}
+
+TEST_F(ChainedHashIndex_test, EntriesWithTheSameKeyAreChainedInTheOrderOfInsertion)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ec502142-0127-4619-9f0a-dc0b75a1899f");
+    insert(7U, 1U);
+    insert(2U, 2U);
+    insert(3U, 1U);
+    insert(11U, 1U);
+
+    EXPECT_THAT(find(1U).length, Eq(3U));
+    EXPECT_THAT(chainOf(1U), ElementsAre(7U, 3U, 11U));
+    EXPECT_THAT(find(2U).length, Eq(1U));
+    EXPECT_THAT(chainOf(2U), ElementsAre(2U));
+}
+
+TEST_F(ChainedHashIndex_test, RemovingEntriesKeepsTheRemainingEntriesInTheChain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e98eed2a-3acd-4d04-a796-5f49d15183d8");
+    insert(0U, 1U);
+    insert(1U, 1U);
+    insert(2U, 1U);
+    insert(3U, 1U);
+
+    remove(0U);
+    EXPECT_THAT(chainOf(1U), ElementsAre(1U, 2U, 3U));
+    remove(2U);
+    EXPECT_THAT(chainOf(1U), ElementsAre(1U, 3U));
+    remove(3U);
+    EXPECT_THAT(chainOf(1U), ElementsAre(1U));
+
+    // the tail must still be valid after removing the last entry
+    insert(5U, 1U);
+    EXPECT_THAT(chainOf(1U), ElementsAre(1U, 5U));
+    EXPECT_THAT(find(1U).length, Eq(2U));
+}
+
+TEST_F(ChainedHashIndex_test, RemovingAChainKeepsCollidingChainsReachable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db50ff5b-c02a-462f-8c19-caa4959b54c2");
+    for (uint32_t key = 0U; key < CAPACITY; ++key)
+    {
+        insert(key, key);
+    }
+
+    for (uint32_t key = 0U; key < CAPACITY; key += 2U)
+    {
+        remove(key);
+    }
+
+    for (uint32_t key = 0U; key < CAPACITY; ++key)
+    {
+        if (key % 2U == 0U)
+        {
+            EXPECT_THAT(find(key).head, Eq(NO_INDEX));
+        }
+        else
+        {
+            EXPECT_THAT(chainOf(key), ElementsAre(key));
+        }
+    }
+}
+
+TEST_F(ChainedHashIndex_test, EntriesWithDifferentHashesAreFoundAfterRemovingOtherEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca706201-70db-40fb-816f-0c4e7b84eb42");
+    for (uint32_t index = 0U; index < CAPACITY; ++index)
+    {
+        const auto key = index % 5U;
+        insert(index, key, idStringHash(iox::capro::IdString_t(iox::TruncateToCapacity, std::to_string(key).c_str())));
+    }
+
+    for (uint32_t index = 0U; index < CAPACITY; index += 3U)
+    {
+        remove(index);
+    }
+
+    for (uint32_t key = 0U; key < 5U; ++key)
+    {
+        std::vector<uint32_t> expectedChain;
+        for (uint32_t index = 0U; index < CAPACITY; ++index)
+        {
+            if (index % 5U == key && index % 3U != 0U)
+            {
+                expectedChain.push_back(index);
+            }
+        }
+        const auto hash = idStringHash(iox::capro::IdString_t(iox::TruncateToCapacity, std::to_string(key).c_str()));
+        EXPECT_THAT(chainOf(key, hash), ContainerEq(expectedChain));
+    }
+}
+
+} // namespace
@@ -40,7 +40,10 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
            && (lhs.roudiConfig.processTerminationDelay == rhs.roudiConfig.processTerminationDelay)
            && (lhs.roudiConfig.processKillDelay == rhs.roudiConfig.processKillDelay)
            && (lhs.roudiConfig.domainId == rhs.roudiConfig.domainId)
-           && (lhs.roudiConfig.uniqueRouDiId == rhs.roudiConfig.uniqueRouDiId) && (lhs.run == rhs.run)
+           && (lhs.roudiConfig.uniqueRouDiId == rhs.roudiConfig.uniqueRouDiId)
+           && (lhs.roudiConfig.memoryPrefaultMode == rhs.roudiConfig.memoryPrefaultMode)
+           && (lhs.roudiConfig.memoryPrefaultThreadCount == rhs.roudiConfig.memoryPrefaultThreadCount)
+           && (lhs.run == rhs.run)
            && (lhs.configFilePath == rhs.configFilePath);
 }
 } // namespace config
@@ -575,6 +578,104 @@ TEST_F(CmdLineParser_test, OutOfBoundsUniqueIdOptionLeadsError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, MemoryPrefaultOptionsLeadToCorrectMode)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9a2c6d1-4f7b-4b83-9d25-8a1f3c6e0b47");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    MemoryPrefaultMode modeArray[] = {MemoryPrefaultMode::OFF, MemoryPrefaultMode::PREFAULT, MemoryPrefaultMode::LOCK};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char optionArray[][20] = {"-p", "--memory-prefault"};
+    char valueArray[][10] = {"off", "on", "lock"};
+    args[0] = &appName[0];
+
+    for (auto optionValue : optionArray)
+    {
+        args[1] = optionValue;
+        uint8_t i{0U};
+        for (auto expectedValue : modeArray)
+        {
+            args[2] = valueArray[i];
+
+            CmdLineParser sut;
+            auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+            ASSERT_FALSE(result.has_error());
+            EXPECT_EQ(result.value().roudiConfig.memoryPrefaultMode, expectedValue);
+            EXPECT_TRUE(result.value().run);
+
+            // Reset optind to be able to parse again
+            optind = 0;
+            i++;
+        }
+    }
+}
+
+TEST_F(CmdLineParser_test, WrongMemoryPrefaultOptionLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d6f3b8e-72a4-4c09-b5e1-9f2d7a4c8e36");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--memory-prefault";
+    char wrongValue[] = "AllOfIt";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &wrongValue[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+}
+
+TEST_F(CmdLineParser_test, MemoryPrefaultThreadsShortOptionLeadsToCorrectThreadCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c4e0a9b-3d58-4f16-a2c7-5b8e1d9f6a03");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-j";
+    char value[] = "8";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().roudiConfig.memoryPrefaultThreadCount, 8U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, MemoryPrefaultThreadsOptionOutOfBoundsLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b82f5d17-6e9c-4a30-8d4b-2c7a9e1f5d68");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--memory-prefault-threads";
+    char valueArray[][10] = {"0", "65"}; // 0 and MAX_NUMBER_OF_MEMORY_PREFAULT_THREADS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    for (auto value : valueArray)
+    {
+        args[2] = value;
+
+        CmdLineParser sut;
+        auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+        ASSERT_TRUE(result.has_error());
+        EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+
+        // Reset optind to be able to parse again
+        optind = 0;
+    }
+}
+
 TEST_F(CmdLineParser_test, CmdLineParsingModeEqualToOneHandlesOnlyTheFirstOption)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1e674db9-d71a-4b82-83cc-eea2e04f4601");
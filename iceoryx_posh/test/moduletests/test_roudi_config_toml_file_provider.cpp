@@ -98,6 +98,186 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingHugePageConfigOfSegmentIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e5b7c3a-1d2f-4e8b-a6c4-3f0d2b1e7a58");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        huge-page-size = 1073741824
+        huge-page-mount-point = "/dev/hugepages1G"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        huge-page-size = 2097152
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+    ASSERT_FALSE(result.has_error());
+
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_hugePageConfig.m_pageSize, Eq(1073741824U));
+    ASSERT_TRUE(segments[0].m_hugePageConfig.m_mountPoint.has_value());
+    EXPECT_TRUE(segments[0].m_hugePageConfig.m_mountPoint->as_string() == "/dev/hugepages1G");
+    EXPECT_THAT(segments[1].m_hugePageConfig.m_pageSize, Eq(2097152U));
+    ASSERT_TRUE(segments[1].m_hugePageConfig.m_mountPoint.has_value());
+    EXPECT_TRUE(segments[1].m_hugePageConfig.m_mountPoint->as_string() == "/dev/hugepages");
+    EXPECT_FALSE(segments[2].m_hugePageConfig.isEnabled());
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingNumaNodesOfSegmentAndMemPoolsIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f2a8d6e-0b3c-4e71-9a5d-c8e1f7b2d046");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        numa-node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment.mempool]]
+        size = 1024
+        count = 1
+        numa-node = 0
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+    ASSERT_FALSE(result.has_error());
+
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    ASSERT_TRUE(segments[0].m_numaNode.has_value());
+    EXPECT_THAT(segments[0].m_numaNode.value(), Eq(1U));
+    const auto& mempools = segments[0].m_mempoolConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(2U));
+    EXPECT_FALSE(mempools[0].m_numaNode.has_value());
+    ASSERT_TRUE(mempools[1].m_numaNode.has_value());
+    EXPECT_THAT(mempools[1].m_numaNode.value(), Eq(0U));
+    EXPECT_FALSE(segments[1].m_numaNode.has_value());
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingMemPoolTypeOfSegmentIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3d9e1f4-6a2c-4c7e-8f15-2e9a0d4c6b71");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        mempool-type = "buddy"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        mempool-type = "fixed-size"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+    ASSERT_FALSE(result.has_error());
+
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_memPoolType, Eq(iox::mepoo::MemPoolType::BUDDY));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_memPoolType, Eq(iox::mepoo::MemPoolType::FIXED_SIZE));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_memPoolType, Eq(iox::mepoo::MemPoolType::FIXED_SIZE));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingEmbeddedChunkManagementOfSegmentIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32e7b091-a821-43c1-9ddf-d1b1a1af9107");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        embedded-chunk-management = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+    ASSERT_FALSE(result.has_error());
+
+    const auto& segments = result->m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_TRUE(segments[0].m_mempoolConfig.m_embedChunkManagement);
+    EXPECT_FALSE(segments[1].m_mempoolConfig.m_embedChunkManagement);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingOverflowCountOfMempoolIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1bdb4662-b7a0-4956-946c-dbc728c4d38a");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 10
+        overflow-count = 20
+
+        [[segment.mempool]]
+        size = 256
+        count = 10
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+    ASSERT_FALSE(result.has_error());
+
+    const auto& mempools = result->m_sharedMemorySegments[0].m_mempoolConfig.m_mempoolConfig;
+    ASSERT_THAT(mempools.size(), Eq(2U));
+    EXPECT_THAT(mempools[0].m_overflowChunkCount, Eq(20U));
+    EXPECT_THAT(mempools[1].m_overflowChunkCount, Eq(0U));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +361,31 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_SEGMENT_WITH_INVALID_HUGE_PAGE_MOUNT_POINT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-page-size = 2097152
+    huge-page-mount-point = "/dev/huge pages"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_SEGMENT_WITH_INVALID_MEMPOOL_TYPE = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    mempool-type = "slab"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +405,10 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT_POINT,
+                                 CONFIG_SEGMENT_WITH_INVALID_HUGE_PAGE_MOUNT_POINT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_TYPE,
+                                 CONFIG_SEGMENT_WITH_INVALID_MEMPOOL_TYPE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
+#include "iox/detail/system_configuration.hpp"
 
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
 #include "mocks/roudi_memory_block_mock.hpp"
@@ -23,6 +24,9 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -144,6 +148,57 @@ TEST_F(RouDiMemoryManager_Test, AddMemoryProviderExceedsCapacity)
     EXPECT_THAT(expectError.error(), Eq(RouDiMemoryManagerError::MEMORY_PROVIDER_EXHAUSTED));
 }
 
+TEST_F(RouDiMemoryManager_Test, CreateAndAnnounceMemoryWithPrefaultingTouchesTheAdditionalMemoryOfTheMemoryBlocks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b0e7c2d-93f1-4a8e-b6d4-1c7f2e9a3b58");
+    constexpr uint64_t MEMORY_SIZE{16};
+    constexpr uint64_t MEMORY_ALIGNMENT{8};
+    constexpr uint32_t PREFAULT_THREAD_COUNT{4};
+    constexpr uint8_t PATTERN{0xA5};
+    std::vector<uint8_t> additionalMemory(10 * iox::detail::pageSize() + 42, PATTERN);
+
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+    EXPECT_CALL(memoryBlock1, onMemoryAvailable(_));
+    EXPECT_CALL(memoryBlock1, forEachAdditionalMemory(_))
+        .WillOnce(Invoke([&](const iox::function_ref<void(void*, uint64_t)> callable) {
+            callable(additionalMemory.data(), additionalMemory.size());
+        }));
+
+    IOX_DISCARD_RESULT(memoryProvider1.addMemoryBlock(&memoryBlock1));
+
+    RouDiMemoryManager sutWithPrefault{MemoryPrefaultMode::PREFAULT, PREFAULT_THREAD_COUNT};
+    ASSERT_FALSE(sutWithPrefault.addMemoryProvider(&memoryProvider1).has_error());
+    EXPECT_FALSE(sutWithPrefault.createAndAnnounceMemory().has_error());
+
+    EXPECT_TRUE(std::all_of(
+        additionalMemory.begin(), additionalMemory.end(), [&](const uint8_t value) { return value == PATTERN; }));
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
+TEST_F(RouDiMemoryManager_Test, CreateAndAnnounceMemoryWithMemoryLockingSucceeds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c41d8a6f-27e3-4b95-8f0a-6e2b9d5c1f73");
+    constexpr uint64_t MEMORY_SIZE{64};
+    constexpr uint64_t MEMORY_ALIGNMENT{8};
+    constexpr uint32_t PREFAULT_THREAD_COUNT{2};
+
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+    EXPECT_CALL(memoryBlock1, onMemoryAvailable(_));
+    EXPECT_CALL(memoryBlock1, forEachAdditionalMemory(_));
+
+    IOX_DISCARD_RESULT(memoryProvider1.addMemoryBlock(&memoryBlock1));
+
+    // locking the memory might fail due to the limit for locked memory; this is not treated as error
+    RouDiMemoryManager sutWithLock{MemoryPrefaultMode::LOCK, PREFAULT_THREAD_COUNT};
+    ASSERT_FALSE(sutWithLock.addMemoryProvider(&memoryProvider1).has_error());
+    EXPECT_FALSE(sutWithLock.createAndAnnounceMemory().has_error());
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+
 TEST_F(RouDiMemoryManager_Test, OperatorTest)
 {
     ::testing::Test::RecordProperty("TEST_ID", "67167a98-5ac2-498d-8062-47a61102a130");
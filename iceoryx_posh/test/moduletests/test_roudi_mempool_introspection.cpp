@@ -72,6 +72,16 @@ class SegmentMock
         return iox::PosixGroup::getGroupOfCurrentProcess();
     }
 
+    uint64_t getPageSize() const
+    {
+        return 4096U;
+    }
+
+    iox::optional<uint32_t> getNumaNode() const
+    {
+        return iox::nullopt;
+    }
+
   private:
     MePooMemoryManager_MOCK memoryManager;
 };
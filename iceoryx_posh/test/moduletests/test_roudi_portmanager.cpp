@@ -23,6 +23,8 @@
 
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 
+#include <vector>
+
 namespace iox_test_roudi_portmanager
 {
 using iox::into;
@@ -912,4 +914,52 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, SubscribersConnectOnlyToPublishersWithTheSameServiceAfterOtherPublishersAreDestroyed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca099e86-5949-42d7-9e8c-ce4967cf7231");
+    constexpr uint32_t NUMBER_OF_SERVICES{32U};
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    std::vector<iox::capro::ServiceDescription> services;
+    std::vector<iox::popo::PublisherPortData*> publisherData;
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        services.push_back(getUniqueSD());
+        publisherData.push_back(m_portManager
+                                    ->acquirePublisherPortData(services.back(),
+                                                               publisherOptions,
+                                                               "guiseppe",
+                                                               m_payloadDataSegmentMemoryManager,
+                                                               PortConfigInfo())
+                                    .value());
+        PublisherPortUser publisher(publisherData.back());
+        publisher.offer();
+    }
+    m_portManager->doDiscovery();
+
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; i += 2U)
+    {
+        PublisherPortUser publisher(publisherData[i]);
+        publisher.destroy();
+    }
+    m_portManager->doDiscovery();
+
+    for (uint32_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        SubscriberPortUser subscriber(
+            m_portManager->acquireSubscriberPortData(services[i], subscriberOptions, "schlomo", PortConfigInfo())
+                .value());
+        subscriber.subscribe();
+
+        m_portManager->doDiscovery();
+
+        for (uint32_t j = 1U; j < NUMBER_OF_SERVICES; j += 2U)
+        {
+            PublisherPortUser publisher(publisherData[j]);
+            EXPECT_THAT(publisher.hasSubscribers(), Eq(j <= i));
+        }
+    }
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -668,4 +668,39 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+// BEGIN DiscoveryNotification tests
+
+TEST_F(PortPool_test, AddedPortsAreAttachedToTheDiscoveryNotificationDataOfThePool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0119ab4-d6a4-4dad-815e-5ea3b8c70604");
+    auto publisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    auto subscriberPort =
+        sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+    ASSERT_FALSE(publisherPort.has_error());
+    ASSERT_FALSE(subscriberPort.has_error());
+
+    EXPECT_THAT(publisherPort.value()->m_discoveryNotificationData.get(), Eq(&sut.getDiscoveryNotificationData()));
+    EXPECT_THAT(publisherPort.value()->m_discoveryNotificationIndex,
+                Eq(popo::DiscoveryNotificationData::PUBLISHER_OFFSET));
+    EXPECT_THAT(subscriberPort.value()->m_discoveryNotificationData.get(), Eq(&sut.getDiscoveryNotificationData()));
+    EXPECT_THAT(subscriberPort.value()->m_discoveryNotificationIndex,
+                Eq(popo::DiscoveryNotificationData::SUBSCRIBER_OFFSET));
+}
+
+TEST_F(PortPool_test, AddedClientPortsGetConsecutiveDiscoveryNotificationIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5702bb62-7b4c-4ab4-a4b0-e2b693474e19");
+    constexpr uint32_t NUMBER_OF_CLIENTS_TO_ADD{2U};
+    uint64_t expectedIndex{popo::DiscoveryNotificationData::CLIENT_OFFSET};
+    auto addSuccessful =
+        addClientPorts(NUMBER_OF_CLIENTS_TO_ADD, [&](const auto&, const auto&, const auto& clientPort) {
+            EXPECT_THAT(clientPort.m_discoveryNotificationIndex, Eq(expectedIndex));
+            ++expectedIndex;
+        });
+    EXPECT_TRUE(addSuccessful);
+}
+
+// END DiscoveryNotification tests
+
 } // namespace
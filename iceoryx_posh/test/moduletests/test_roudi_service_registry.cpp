@@ -22,6 +22,7 @@
 
 #include "test.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <random>
 #include <vector>
@@ -634,6 +635,76 @@ TYPED_TEST(ServiceRegistry_test, SearchInFullRegistryWorks)
     ASSERT_EQ(this->searchResult.size(), 1);
 }
 
+TYPED_TEST(ServiceRegistry_test, SearchAfterRandomlyAddingAndRemovingFindsTheSameEntriesAsIteratingAllEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1250043-2a51-4b8f-b5e0-484ab32fa404");
+    // few distinct IDs in order to have many entries with the same service, instance or event ID
+    const std::vector<IdString_t> services{"s0", "s1", "s2"};
+    const std::vector<IdString_t> instances{"i0", "i1", "i2", "i3"};
+    const std::vector<IdString_t> events{"e0", "e1", "e2", "e3", "e4"};
+    auto randomServiceDescription = [&](std::mt19937& generator) {
+        return ServiceDescription(services[generator() % services.size()],
+                                  instances[generator() % instances.size()],
+                                  events[generator() % events.size()]);
+    };
+
+    std::mt19937 generator{42U};
+    constexpr uint32_t NUMBER_OF_OPERATIONS{2000U};
+    for (uint32_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+    {
+        const auto serviceDescription = randomServiceDescription(generator);
+        if (generator() % 3U == 0U)
+        {
+            this->sut.remove(serviceDescription);
+        }
+        else
+        {
+            ASSERT_FALSE(this->sut.add(serviceDescription).has_error());
+        }
+    }
+
+    auto expectSameEntriesAsIteratingAllEntries = [&](const optional<IdString_t>& service,
+                                                      const optional<IdString_t>& instance,
+                                                      const optional<IdString_t>& event) {
+        std::vector<ServiceDescription> expected;
+        this->sut->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            const auto& sd = entry.serviceDescription;
+            if ((!service || sd.getServiceIDString() == *service)
+                && (!instance || sd.getInstanceIDString() == *instance)
+                && (!event || sd.getEventIDString() == *event))
+            {
+                expected.push_back(sd);
+            }
+        });
+
+        this->find(service, instance, event);
+        ASSERT_THAT(this->searchResult.size(), Eq(expected.size()));
+        for (const auto& sd : expected)
+        {
+            EXPECT_TRUE(std::any_of(this->searchResult.begin(), this->searchResult.end(), [&](const auto& entry) {
+                return entry.serviceDescription == sd;
+            }));
+        }
+    };
+
+    for (const auto& service : services)
+    {
+        expectSameEntriesAsIteratingAllEntries(service, iox::capro::Wildcard, iox::capro::Wildcard);
+        for (const auto& instance : instances)
+        {
+            expectSameEntriesAsIteratingAllEntries(iox::capro::Wildcard, instance, iox::capro::Wildcard);
+            expectSameEntriesAsIteratingAllEntries(service, instance, iox::capro::Wildcard);
+            for (const auto& event : events)
+            {
+                expectSameEntriesAsIteratingAllEntries(iox::capro::Wildcard, iox::capro::Wildcard, event);
+                expectSameEntriesAsIteratingAllEntries(service, iox::capro::Wildcard, event);
+                expectSameEntriesAsIteratingAllEntries(iox::capro::Wildcard, instance, event);
+                expectSameEntriesAsIteratingAllEntries(service, instance, event);
+            }
+        }
+    }
+}
+
 TYPED_TEST(ServiceRegistry_test, FunctionIsAppliedToAllEntriesInSearchResult)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b7828085-d879-43b7-9fee-e5e88cf36995");
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool_magazine.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t USER_PAYLOAD_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{1024U};
+constexpr uint32_t CHUNKS_IN_USE{8U};
+constexpr uint32_t NUMBER_OF_SUBSCRIBERS{4U};
+constexpr uint64_t NUMBER_OF_ITERATIONS{2000000U};
+
+enum class Scenario
+{
+    /// @brief a chunk is obtained from the MemoryManager and released
+    LOAN_RELEASE,
+    /// @brief a chunk is obtained via the chunk magazine like by a publisher and released
+    LOAN_RELEASE_WITH_MAGAZINE,
+    /// @brief a chunk is obtained, shared with the subscribers and released by all of them
+    LOAN_SHARE_RELEASE
+};
+
+const char* scenarioName(const Scenario scenario)
+{
+    switch (scenario)
+    {
+    case Scenario::LOAN_RELEASE:
+        return "loan/release";
+    case Scenario::LOAN_RELEASE_WITH_MAGAZINE:
+        return "loan/release with magazine";
+    case Scenario::LOAN_SHARE_RELEASE:
+        return "loan/share/release";
+    }
+    return "unknown";
+}
+
+void performBenchmark(const Scenario scenario, const bool embedChunkManagement)
+{
+    iox::mepoo::MePooConfig mePooConfig;
+    mePooConfig.m_embedChunkManagement = embedChunkManagement;
+    mePooConfig.addMemPool({USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mePooConfig);
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[memorySize]};
+    iox::BumpAllocator allocator{memory.get(), memorySize};
+    std::unique_ptr<iox::mepoo::MemoryManager> memoryManager{new iox::mepoo::MemoryManager()};
+    memoryManager->configureMemoryManager(mePooConfig, allocator, allocator);
+    std::unique_ptr<iox::mepoo::ChunkMagazine> chunkMagazine{new iox::mepoo::ChunkMagazine()};
+
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                             .expect("Valid 'ChunkSettings'");
+
+    // a few chunks are kept in use in order to not always obtain the same chunk from the free list
+    std::vector<iox::mepoo::SharedChunk> chunksInUse(CHUNKS_IN_USE);
+    std::vector<iox::mepoo::SharedChunk> subscribers(NUMBER_OF_SUBSCRIBERS);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        auto& chunk = chunksInUse[i % CHUNKS_IN_USE];
+        if (scenario == Scenario::LOAN_RELEASE_WITH_MAGAZINE)
+        {
+            chunk = memoryManager->getChunk(chunkSettings, *chunkMagazine).expect("Obtaining chunk");
+        }
+        else
+        {
+            chunk = memoryManager->getChunk(chunkSettings).expect("Obtaining chunk");
+        }
+
+        if (scenario == Scenario::LOAN_SHARE_RELEASE)
+        {
+            for (auto& subscriber : subscribers)
+            {
+                subscriber = chunk;
+            }
+            for (auto& subscriber : subscribers)
+            {
+                subscriber = iox::mepoo::SharedChunk();
+            }
+        }
+    }
+    chunksInUse.clear();
+    auto end = std::chrono::steady_clock::now();
+    chunkMagazine->drain();
+
+    // Not using iceoryx logger due to width requirements
+    auto durationNanoSeconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    std::cout << std::setw(28) << scenarioName(scenario) << " : " << std::setw(9)
+              << (embedChunkManagement ? "embedded" : "pool") << " : " << std::setw(6)
+              << durationNanoSeconds / NUMBER_OF_ITERATIONS << " (nanosecs/iters)" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    for (auto scenario :
+         {Scenario::LOAN_RELEASE, Scenario::LOAN_RELEASE_WITH_MAGAZINE, Scenario::LOAN_SHARE_RELEASE})
+    {
+        performBenchmark(scenario, false);
+        performBenchmark(scenario, true);
+    }
+
+    return EXIT_SUCCESS;
+}
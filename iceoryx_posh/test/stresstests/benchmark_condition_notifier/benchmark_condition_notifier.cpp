@@ -0,0 +1,140 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_NOTIFICATIONS{1000000U};
+constexpr uint64_t BURST_SIZE{100U};
+constexpr uint64_t NUMBER_OF_NOTIFIERS{4U};
+
+enum class Scenario
+{
+    /// @brief the listener is busy and collects the notifications after every burst without blocking
+    BUSY_LISTENER,
+    /// @brief the listener blocks in wait and is woken up by the bursts of notifications
+    SLEEPING_LISTENER
+};
+
+const char* scenarioName(const Scenario scenario)
+{
+    switch (scenario)
+    {
+    case Scenario::BUSY_LISTENER:
+        return "busy listener";
+    case Scenario::SLEEPING_LISTENER:
+        return "sleeping listener";
+    }
+    return "unknown";
+}
+
+/// @brief returns the number of wake-up signals which were not consumed by a blocking listener; these are the pending
+///        posts of the semaphore, a futex wake-up is never pending
+uint64_t numberOfUnconsumedSignals(iox::popo::ConditionVariableData& condVarData)
+{
+    if (IOX_FUTEX_AVAILABLE)
+    {
+        return 0U;
+    }
+
+    uint64_t numberOfPosts{0U};
+    while (condVarData.m_semaphore->tryWait().expect("Valid semaphore"))
+    {
+        ++numberOfPosts;
+    }
+    return numberOfPosts;
+}
+
+void notifyInBursts(iox::popo::ConditionVariableData& condVarData,
+                    const std::function<void()>& afterBurst = std::function<void()>())
+{
+    std::unique_ptr<iox::popo::ConditionNotifier> notifiers[NUMBER_OF_NOTIFIERS];
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFIERS; ++i)
+    {
+        notifiers[i].reset(new iox::popo::ConditionNotifier(condVarData, i));
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_NOTIFICATIONS; ++i)
+    {
+        notifiers[i % NUMBER_OF_NOTIFIERS]->notify();
+        if ((i + 1U) % BURST_SIZE == 0U && afterBurst)
+        {
+            afterBurst();
+        }
+    }
+}
+
+void performBenchmark(const Scenario scenario)
+{
+    std::unique_ptr<iox::popo::ConditionVariableData> condVarData{new iox::popo::ConditionVariableData()};
+    iox::popo::ConditionListener listener{*condVarData};
+
+    uint64_t numberOfSignals{0U};
+    uint64_t numberOfWakeUps{0U};
+    auto start = std::chrono::steady_clock::now();
+    if (scenario == Scenario::BUSY_LISTENER)
+    {
+        notifyInBursts(*condVarData, [&] {
+            numberOfSignals += numberOfUnconsumedSignals(*condVarData);
+            listener.wait();
+        });
+    }
+    else
+    {
+        std::thread listenerThread([&] {
+            while (!listener.wait().empty())
+            {
+                ++numberOfWakeUps;
+            }
+        });
+        notifyInBursts(*condVarData, [] { std::this_thread::yield(); });
+        listener.destroy();
+        listenerThread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    numberOfSignals += numberOfUnconsumedSignals(*condVarData);
+
+    // Not using iceoryx logger due to width requirements
+    auto durationNanoSeconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    std::cout << std::setw(18) << scenarioName(scenario) << " : " << std::setw(6)
+              << durationNanoSeconds / NUMBER_OF_NOTIFICATIONS << " (nanosecs/notify) : " << std::setw(8)
+              << numberOfSignals << " (unconsumed signals) : " << std::setw(8) << numberOfWakeUps << " (wake-ups)"
+              << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::cout << NUMBER_OF_NOTIFICATIONS << " notifications in bursts of " << BURST_SIZE << std::endl;
+    for (auto scenario : {Scenario::BUSY_LISTENER, Scenario::SLEEPING_LISTENER})
+    {
+        performBenchmark(scenario);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+// Copyright (c) 2026 by ekxide IO GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t USER_PAYLOAD_SIZE{128U};
+constexpr uint32_t LIST_CAPACITY{iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY};
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+
+using UsedChunkList_t = iox::popo::UsedChunkList<LIST_CAPACITY>;
+
+enum class Scenario
+{
+    /// @brief the chunk which is held the longest is removed
+    OLDEST_FIRST,
+    /// @brief the chunk which was inserted last is removed
+    NEWEST_FIRST,
+    /// @brief a randomly chosen held chunk is removed
+    RANDOM_ORDER
+};
+
+const char* scenarioName(const Scenario scenario)
+{
+    switch (scenario)
+    {
+    case Scenario::OLDEST_FIRST:
+        return "oldest first";
+    case Scenario::NEWEST_FIRST:
+        return "newest first";
+    case Scenario::RANDOM_ORDER:
+        return "random order";
+    }
+    return "unknown";
+}
+
+void performBenchmark(const Scenario scenario, const uint32_t numberOfHeldChunks)
+{
+    iox::mepoo::MePooConfig mePooConfig;
+    mePooConfig.addMemPool({USER_PAYLOAD_SIZE, LIST_CAPACITY + 1U});
+
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mePooConfig);
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[memorySize]};
+    iox::BumpAllocator allocator{memory.get(), memorySize};
+    std::unique_ptr<iox::mepoo::MemoryManager> memoryManager{new iox::mepoo::MemoryManager()};
+    memoryManager->configureMemoryManager(mePooConfig, allocator, allocator);
+    std::unique_ptr<UsedChunkList_t> usedChunkList{new UsedChunkList_t()};
+
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                             .expect("Valid 'ChunkSettings'");
+
+    // one chunk more than held is needed to insert a chunk before one is removed
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0U; i <= numberOfHeldChunks; ++i)
+    {
+        chunks.emplace_back(memoryManager->getChunk(chunkSettings).expect("Obtaining chunk"));
+    }
+
+    // indices of the chunks in the list, ordered from the oldest to the newest one
+    std::deque<uint32_t> heldChunks;
+    for (uint32_t i = 0U; i < numberOfHeldChunks; ++i)
+    {
+        usedChunkList->insert(chunks[i]);
+        heldChunks.push_back(i);
+    }
+    uint32_t freeChunk{numberOfHeldChunks};
+    std::mt19937 generator{42U};
+
+    iox::mepoo::SharedChunk removedChunk;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        usedChunkList->insert(chunks[freeChunk]);
+        heldChunks.push_back(freeChunk);
+
+        auto position = heldChunks.begin();
+        if (scenario == Scenario::NEWEST_FIRST)
+        {
+            position = heldChunks.end() - 1;
+        }
+        else if (scenario == Scenario::RANDOM_ORDER)
+        {
+            position += static_cast<std::ptrdiff_t>(generator() % heldChunks.size());
+        }
+        freeChunk = *position;
+        heldChunks.erase(position);
+
+        if (!usedChunkList->remove(chunks[freeChunk].getChunkHeader(), removedChunk))
+        {
+            std::cerr << "Chunk not found in the UsedChunkList!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    usedChunkList->cleanup();
+
+    // Not using iceoryx logger due to width requirements
+    auto durationNanoSeconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    std::cout << std::setw(14) << scenarioName(scenario) << " : " << std::setw(4) << numberOfHeldChunks
+              << " held : " << std::setw(6) << durationNanoSeconds / NUMBER_OF_ITERATIONS << " (nanosecs/iters)"
+              << std::endl;
+}
+} // namespace
+
+int main()
+{
+    for (auto scenario : {Scenario::OLDEST_FIRST, Scenario::NEWEST_FIRST, Scenario::RANDOM_ORDER})
+    {
+        for (uint32_t numberOfHeldChunks = 1U; numberOfHeldChunks < LIST_CAPACITY; numberOfHeldChunks *= 4U)
+        {
+            performBenchmark(scenario, numberOfHeldChunks);
+        }
+        performBenchmark(scenario, LIST_CAPACITY - 1U);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -132,6 +132,9 @@ class IntrospectionApp
     /// @brief prints table showing current mempool usage
     void printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo);
 
+    /// @brief prints the NUMA node or '-' if there is none
+    void printNumaNode(const iox::optional<uint32_t>& numaNode, const int32_t width, const char* suffix);
+
     template <typename Topic>
     iox::unique_ptr<iox::popo::Subscriber<Topic>>
     createSubscriber(const iox::capro::ServiceDescription& serviceDescription) noexcept;
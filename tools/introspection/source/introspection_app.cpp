@@ -296,6 +296,18 @@ constexpr const char* format_uint64_t<unsigned long long>() noexcept
 template <typename T>
 static constexpr const char* FORMAT_UINT64_T{format_uint64_t<T>()};
 
+void IntrospectionApp::printNumaNode(const iox::optional<uint32_t>& numaNode, const int32_t width, const char* suffix)
+{
+    if (numaNode.has_value())
+    {
+        wprintw(pad, "%*u%s", width, numaNode.value(), suffix);
+    }
+    else
+    {
+        wprintw(pad, "%*s%s", width, "-", suffix);
+    }
+}
+
 void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspectionInfo)
 {
     wprintw(pad, "Segment ID: %d\n", introspectionInfo.m_id);
@@ -306,7 +318,13 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
 
     wprintw(pad, "Shared memory segment reader group: ");
     prettyPrint(iox::into<std::string>(introspectionInfo.m_readerGroupName), PrettyOptions::bold);
-    wprintw(pad, "\n\n");
+    wprintw(pad, "\n");
+
+    wprintw(pad, "Shared memory segment page size: ");
+    wprintw(pad, FORMAT_UINT64_T<uint64_t>, 0, introspectionInfo.m_pageSize, "\n");
+
+    wprintw(pad, "Shared memory segment NUMA node: ");
+    printNumaNode(introspectionInfo.m_numaNode, 0, "\n\n");
 
     constexpr int32_t memPoolWidth{8};
     constexpr int32_t usedchunksWidth{14};
@@ -314,14 +332,20 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t numaNodeWidth{9};
+    constexpr int32_t leakedChunksWidth{7};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s |", numaNodeWidth, "NUMA Node");
+    wprintw(pad, "%*s\n", leakedChunksWidth, "Leaked");
+    wprintw(pad,
+            "--------------------------------------------------------------------------------------------"
+            "----------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -333,7 +357,9 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*u |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*u |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkSizeWidth, info.m_chunkSize, " |");
-            wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, "\n");
+            wprintw(pad, FORMAT_UINT64_T<uint64_t>, chunkPayloadSizeWidth, info.m_chunkPayloadSize, " |");
+            printNumaNode(info.m_numaNode, numaNodeWidth, " |");
+            wprintw(pad, FORMAT_UINT64_T<uint64_t>, leakedChunksWidth, info.m_leakedChunks, "\n");
         }
     }
     wprintw(pad, "\n");